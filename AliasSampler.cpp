@@ -0,0 +1,113 @@
+// Author: Forrest Miller
+// Filename: AliasSampler.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "AliasSampler.h"
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the AliasSampler
+//          class. build() follows Vose's algorithm: weights are scaled so the
+//          average is 1, then 'small' columns (below 1) are paired with
+//          'large' columns that donate the rest of their probability.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+//   Implementation Invariants:
+//        threshold[i] is in [0, 2^32]. A threshold of 2^32 means the column
+//          never uses its alias.
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const double TWO_TO_THE_32 = 4294967296.0;
+const uint64_t ALWAYS_KEEP_COLUMN = 4294967296ull;
+const uint64_t LOW_32_BITS = 0xFFFFFFFFull;
+const int HALF_WORD_BITS = 32;
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+AliasSampler::AliasSampler(void) {
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+bool AliasSampler::build(const std::vector<double>& weights) {
+    this->threshold.clear();
+    this->alias.clear();
+    const uint32_t n = (uint32_t) weights.size();
+    double total = 0.0;
+    for (double w : weights) {
+        if (w > 0.0) {
+            total += w;
+        }
+    }
+    if (0u == n || total <= 0.0) {
+        return false;
+    }
+
+    std::vector<double> scaled(n);
+    std::vector<uint32_t> small;
+    std::vector<uint32_t> large;
+    for (uint32_t i = 0u; i < n; i++) {
+        scaled[i] = (weights[i] > 0.0) ? (weights[i] * n / total) : 0.0;
+        if (scaled[i] < 1.0) {
+            small.push_back(i);
+        }
+        else {
+            large.push_back(i);
+        }
+    }
+
+    this->threshold.assign(n, ALWAYS_KEEP_COLUMN);
+    this->alias.resize(n);
+    for (uint32_t i = 0u; i < n; i++) {
+        this->alias[i] = i;
+    }
+    while (!small.empty() && !large.empty()) {
+        uint32_t less = small.back();
+        small.pop_back();
+        uint32_t more = large.back();
+        large.pop_back();
+        this->threshold[less] = (uint64_t) (scaled[less] * TWO_TO_THE_32);
+        this->alias[less] = more;
+        //The large column gives away what the small column was missing
+        scaled[more] = (scaled[more] + scaled[less]) - 1.0;
+        if (scaled[more] < 1.0) {
+            small.push_back(more);
+        }
+        else {
+            large.push_back(more);
+        }
+    }
+    //Anything left over is 1 up to rounding error, so it keeps its column.
+    //(Already set to ALWAYS_KEEP_COLUMN above.)
+    return true;
+}
+
+uint32_t AliasSampler::draw(FastRandom& rng) const {
+    const uint32_t n = (uint32_t) this->alias.size();
+    uint64_t bits = rng.next();
+    //Upper half picks the column (Lemire's method), lower half flips the coin
+    uint64_t product = (bits >> HALF_WORD_BITS) * (uint64_t) n;
+    if ((uint32_t) product < n) {
+        uint32_t rejectBelow = (uint32_t) (-n) % n;
+        while ((uint32_t) product < rejectBelow) {
+            bits = rng.next();
+            product = (bits >> HALF_WORD_BITS) * (uint64_t) n;
+        }
+    }
+    uint32_t column = (uint32_t) (product >> HALF_WORD_BITS);
+    if ((bits & LOW_32_BITS) < this->threshold[column]) {
+        return column;
+    }
+    return this->alias[column];
+}
+
+uint32_t AliasSampler::size(void) const {
+    return (uint32_t) this->alias.size();
+}
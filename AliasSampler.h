@@ -0,0 +1,72 @@
+// Author: Forrest Miller
+// Filename: AliasSampler.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef AliasSampler_h
+#define AliasSampler_h
+
+#include "FastRandom.h"
+#include <stdint.h>
+#include <vector>
+
+//
+// Class Overview:
+//     This class draws indices according to a set of non-negative weights in
+//     constant time, no matter how many weights there are, using Walker's
+//     alias method (built with Vose's numerically stable construction). Each
+//     draw picks a column uniformly and then flips one biased coin to decide
+//     between the column and its alias, all from a single 64-bit random
+//     number.
+//
+// Valid States include: A default constructed sampler is empty and must not be
+//                       drawn from. After a successful build() the sampler
+//                       holds one column per weight.
+//
+// Anticipated Use:  One sampler per word length, built once after the puzzles
+//                   are generated and then used on every round to pick which
+//                   puzzle the player sees.
+//
+// Class Invariants:  -After a successful build, size() equals the number of
+//                     weights and every alias refers to a valid column.
+//                    -draw() is const, so one built sampler can be shared by
+//                     many threads, each with its own FastRandom.
+//
+// Assumptions:
+//      -Weights are finite and non-negative. At least one must be positive.
+//      -There are fewer than 2^32 weights.
+//
+// Dependencies: FastRandom
+//
+
+class AliasSampler {
+private:
+    std::vector<uint64_t> threshold; //Chance to keep the column, out of 2^32
+    std::vector<uint32_t> alias;     //Index used when the coin says no
+
+    friend class MemoryFootprint; //Reports the memory it takes
+public:
+    AliasSampler(void);
+    //Description: Constructs an empty sampler
+    //Preconditions: None
+    //Postconditions: size() is 0
+
+    bool build(const std::vector<double>& weights);
+    //Description: Builds the alias table for the weights. Index i will be
+    //             drawn with probability weights[i] / sum(weights).
+    //Preconditions: Weights should be non-negative
+    //Postconditions: Returns false (and leaves the sampler empty) if there are
+    //                no weights or none of them are positive.
+
+    uint32_t draw(FastRandom& rng) const;
+    //Description: Draws an index in O(1) without modulo bias
+    //Preconditions: Sampler must have been built successfully
+    //Postconditions: None, this method is const (the generator advances)
+
+    uint32_t size(void) const;
+    //Description: Returns the number of columns in the table
+    //Preconditions: None
+    //Postconditions: None, this method is const
+};
+
+#endif /* AliasSampler_h */
@@ -0,0 +1,333 @@
+// Author: Forrest Miller
+// Filename: AllocationTracker.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "AllocationTracker.h"
+#include <atomic>
+#include <new>
+#include <stdio.h>
+#include <stdlib.h>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the
+//          AllocationTracker class and, when P4_TRACK_ALLOCATIONS is defined,
+//          the replacement operator new and operator delete. Nothing on the
+//          allocation path may itself call new, or it would recurse: a
+//          thread's counters come from malloc() and are registered in a
+//          fixed array, and the thread-local pointers are plain pointers
+//          that need no constructor. Each block is given a small header in
+//          front of the memory handed out, holding the size asked for, the
+//          tag it was charged to, and how far the header is from the start
+//          of what malloc() returned.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const int MAX_ALLOC_THREADS = 256;
+const int REPORT_LINE_BYTES = 128;
+const char * const ALLOC_TAG_NAMES[NUM_ALLOC_TAGS] = {"untagged",
+    "dictionary", "corpus build", "puzzle pool", "round", "grading"};
+
+thread_local int currentTag = ALLOC_UNTAGGED;
+
+#ifdef P4_TRACK_ALLOCATIONS
+const int COUNT_ALLOCATIONS = 0;
+const int COUNT_BYTES = 1;
+const int COUNT_FREES = 2;
+const int COUNT_FREED_BYTES = 3;
+const int NUM_ALLOC_COUNTS = 4;
+
+//Sits right in front of every block handed out. Its size keeps the block
+//as aligned as malloc() made it.
+struct alignas(16) BlockHeader {
+    uint64_t size;
+    uint32_t tag;
+    uint32_t offset; //From what malloc() returned to the block
+};
+const size_t BLOCK_HEADER_BYTES = sizeof(BlockHeader);
+
+struct ThreadAllocations {
+    std::atomic<uint64_t> counts[NUM_ALLOC_TAGS][NUM_ALLOC_COUNTS];
+    bool shared; //The overflow counters, which every late thread adds to
+};
+
+static std::atomic<ThreadAllocations *> registry[MAX_ALLOC_THREADS];
+static std::atomic<int> registered(0);
+static ThreadAllocations overflow = {{}, true};
+thread_local ThreadAllocations * threadAllocations = nullptr;
+
+static ThreadAllocations * mine(void) {
+    ThreadAllocations * counters = threadAllocations;
+    if (nullptr != counters) {
+        return counters;
+    }
+    int slot = registered.fetch_add(1);
+    void * memory = (slot < MAX_ALLOC_THREADS) ?
+                    malloc(sizeof(ThreadAllocations)) : nullptr;
+    if (nullptr == memory) {
+        counters = &overflow;
+    }
+    else {
+        counters = new (memory) ThreadAllocations(); //Zeroed
+        counters->shared = false;
+        registry[slot].store(counters, std::memory_order_release);
+    }
+    threadAllocations = counters;
+    return counters;
+}
+
+static void bump(ThreadAllocations * counters, int tag, int count,
+                 uint64_t amount) {
+    std::atomic<uint64_t>& counter = counters->counts[tag][count];
+    if (counters->shared) {
+        counter.fetch_add(amount, std::memory_order_relaxed);
+    }
+    else { //Only this thread writes it
+        counter.store(counter.load(std::memory_order_relaxed) + amount,
+                      std::memory_order_relaxed);
+    }
+}
+
+//Returns the block for size bytes aligned to alignment (a power of two, at
+//least as large as a pointer), or null if there is no memory
+static void * allocate(size_t size, size_t alignment) {
+    size_t headerSpace = BLOCK_HEADER_BYTES;
+    void * base = nullptr;
+    if (alignment <= BLOCK_HEADER_BYTES) {
+        base = malloc(headerSpace + size);
+    }
+    else {
+        headerSpace = alignment; //A multiple of the header's size
+        if (0 != posix_memalign(&base, alignment, headerSpace + size)) {
+            base = nullptr;
+        }
+    }
+    if (nullptr == base) {
+        return nullptr;
+    }
+    char * block = static_cast<char *>(base) + headerSpace;
+    BlockHeader * header = reinterpret_cast<BlockHeader *>(block) - 1;
+    header->size = size;
+    header->tag = (uint32_t) currentTag;
+    header->offset = (uint32_t) headerSpace;
+    ThreadAllocations * counters = mine();
+    bump(counters, currentTag, COUNT_ALLOCATIONS, 1u);
+    bump(counters, currentTag, COUNT_BYTES, size);
+    return block;
+}
+
+static void release(void * block) {
+    if (nullptr == block) {
+        return;
+    }
+    BlockHeader * header = static_cast<BlockHeader *>(block) - 1;
+    ThreadAllocations * counters = mine();
+    bump(counters, (int) header->tag, COUNT_FREES, 1u);
+    bump(counters, (int) header->tag, COUNT_FREED_BYTES, header->size);
+    free(static_cast<char *>(block) - header->offset);
+}
+
+//What operator new does when there is no memory: ask the new-handler to
+//find some and try again, or throw if there is no handler
+static void * allocateOrThrow(size_t size, size_t alignment) {
+    void * block;
+    while (nullptr == (block = allocate(size, alignment))) {
+        std::new_handler handler = std::get_new_handler();
+        if (nullptr == handler) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+    return block;
+}
+
+static void * allocateOrNull(size_t size, size_t alignment) noexcept {
+    try {
+        return allocateOrThrow(size, alignment);
+    }
+    catch (...) {
+        return nullptr;
+    }
+}
+
+//--------------------------------------------------------------------
+//  Replacement operators
+//--------------------------------------------------------------------
+void * operator new(size_t size) {
+    return allocateOrThrow(size, 0u);
+}
+
+void * operator new[](size_t size) {
+    return allocateOrThrow(size, 0u);
+}
+
+void * operator new(size_t size, const std::nothrow_t&) noexcept {
+    return allocateOrNull(size, 0u);
+}
+
+void * operator new[](size_t size, const std::nothrow_t&) noexcept {
+    return allocateOrNull(size, 0u);
+}
+
+void * operator new(size_t size, std::align_val_t alignment) {
+    return allocateOrThrow(size, (size_t) alignment);
+}
+
+void * operator new[](size_t size, std::align_val_t alignment) {
+    return allocateOrThrow(size, (size_t) alignment);
+}
+
+void * operator new(size_t size, std::align_val_t alignment,
+                    const std::nothrow_t&) noexcept {
+    return allocateOrNull(size, (size_t) alignment);
+}
+
+void * operator new[](size_t size, std::align_val_t alignment,
+                      const std::nothrow_t&) noexcept {
+    return allocateOrNull(size, (size_t) alignment);
+}
+
+void operator delete(void * block) noexcept {
+    release(block);
+}
+
+void operator delete[](void * block) noexcept {
+    release(block);
+}
+
+void operator delete(void * block, size_t) noexcept {
+    release(block);
+}
+
+void operator delete[](void * block, size_t) noexcept {
+    release(block);
+}
+
+void operator delete(void * block, const std::nothrow_t&) noexcept {
+    release(block);
+}
+
+void operator delete[](void * block, const std::nothrow_t&) noexcept {
+    release(block);
+}
+
+void operator delete(void * block, std::align_val_t) noexcept {
+    release(block);
+}
+
+void operator delete[](void * block, std::align_val_t) noexcept {
+    release(block);
+}
+
+void operator delete(void * block, size_t, std::align_val_t) noexcept {
+    release(block);
+}
+
+void operator delete[](void * block, size_t, std::align_val_t) noexcept {
+    release(block);
+}
+
+void operator delete(void * block, std::align_val_t,
+                     const std::nothrow_t&) noexcept {
+    release(block);
+}
+
+void operator delete[](void * block, std::align_val_t,
+                       const std::nothrow_t&) noexcept {
+    release(block);
+}
+
+static void addCounts(const ThreadAllocations * counters,
+                      AllocationStats& stats) {
+    for (int tag = 0; tag < NUM_ALLOC_TAGS; tag++) {
+        AllocationCounts& into = stats.byTag[tag];
+        const std::atomic<uint64_t> * from = counters->counts[tag];
+        into.allocations += from[COUNT_ALLOCATIONS].load(
+                                                    std::memory_order_relaxed);
+        into.bytes += from[COUNT_BYTES].load(std::memory_order_relaxed);
+        into.frees += from[COUNT_FREES].load(std::memory_order_relaxed);
+        into.freedBytes += from[COUNT_FREED_BYTES].load(
+                                                    std::memory_order_relaxed);
+    }
+}
+#endif
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+bool AllocationTracker::isEnabled(void) {
+#ifdef P4_TRACK_ALLOCATIONS
+    return true;
+#else
+    return false;
+#endif
+}
+
+int AllocationTracker::setTag(int tag) {
+    int previous = currentTag;
+    currentTag = tag;
+    return previous;
+}
+
+void AllocationTracker::snapshot(AllocationStats& stats) {
+    AllocationCounts none = {0u, 0u, 0u, 0u};
+    for (int tag = 0; tag < NUM_ALLOC_TAGS; tag++) {
+        stats.byTag[tag] = none;
+    }
+    stats.total = none;
+#ifdef P4_TRACK_ALLOCATIONS
+    int threads = registered.load();
+    for (int slot = 0; slot < threads && slot < MAX_ALLOC_THREADS; slot++) {
+        //A slot just handed out may not be filled in yet
+        const ThreadAllocations * counters =
+        registry[slot].load(std::memory_order_acquire);
+        if (nullptr != counters) {
+            addCounts(counters, stats);
+        }
+    }
+    addCounts(&overflow, stats);
+#endif
+    for (int tag = 0; tag < NUM_ALLOC_TAGS; tag++) {
+        stats.total.allocations += stats.byTag[tag].allocations;
+        stats.total.bytes += stats.byTag[tag].bytes;
+        stats.total.frees += stats.byTag[tag].frees;
+        stats.total.freedBytes += stats.byTag[tag].freedBytes;
+    }
+}
+
+const char * AllocationTracker::tagName(int tag) {
+    return ALLOC_TAG_NAMES[tag];
+}
+
+void AllocationTracker::report(std::ostream& out) {
+    if (!isEnabled()) {
+        out << "Allocation tracking is off (build with "
+        "-DP4_TRACK_ALLOCATIONS)\n";
+        out.flush();
+        return;
+    }
+    AllocationStats stats;
+    snapshot(stats);
+    out << "Allocations        Allocs         Bytes         Frees"
+    "    Live bytes\n";
+    char line[REPORT_LINE_BYTES];
+    for (int tag = 0; tag <= NUM_ALLOC_TAGS; tag++) {
+        const AllocationCounts& counts = (NUM_ALLOC_TAGS == tag) ?
+                                         stats.total : stats.byTag[tag];
+        snprintf(line, sizeof(line), "%-14s %10llu %13llu %13llu %13lld\n",
+                 (NUM_ALLOC_TAGS == tag) ? "total" : ALLOC_TAG_NAMES[tag],
+                 (unsigned long long) counts.allocations,
+                 (unsigned long long) counts.bytes,
+                 (unsigned long long) counts.frees,
+                 //Can dip below zero if a free on one thread is counted
+                 //before its allocation on another, mid-snapshot
+                 (long long) (counts.bytes - counts.freedBytes));
+        out << line;
+    }
+    out.flush();
+}
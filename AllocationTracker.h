@@ -0,0 +1,122 @@
+// Author: Forrest Miller
+// Filename: AllocationTracker.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef AllocationTracker_h
+#define AllocationTracker_h
+
+//#define P4_TRACK_ALLOCATIONS //Uncomment (or build with
+                               //-DP4_TRACK_ALLOCATIONS) to count every
+                               //allocation. Every file must agree on it.
+
+#include <ostream>
+#include <stdint.h>
+
+//
+// Class Overview:
+//     These classes count the program's heap allocations and charge each one
+//     to the part of the program that made it, so we can see which subsystem
+//     allocates and how much without attaching a heap profiler. The global
+//     operator new and operator delete are replaced with versions that count
+//     into per-thread counters under the calling thread's current tag. An
+//     AllocationScope sets the tag for the scope it is declared in (and puts
+//     the previous one back when it ends), so code is charged to a subsystem
+//     just by declaring one at the top of a function. Each block remembers
+//     the tag and size it was allocated with, so frees are charged back to
+//     the subsystem that allocated the memory, whichever thread frees it.
+//
+//     Tracking is compiled in only when P4_TRACK_ALLOCATIONS is defined.
+//     Otherwise the default operators are used, AllocationScope is an empty
+//     class and every scope compiles away.
+//
+// Valid States include: AllocationTracker has only static members. An
+//                       AllocationScope is active until it is destroyed.
+//
+// Anticipated Use:  Declare 'AllocationScope scope(ALLOC_...);' first thing
+//                   in a function to charge it to a subsystem. main() prints
+//                   the report at shutdown and the benchmarks give
+//                   allocations per operation.
+//
+// Class Invariants:  -A thread's counters are written only by that thread
+//                     (past MAX_ALLOC_THREADS threads, the rest share one
+//                     set of counters updated atomically).
+//                    -A block's tag and size never change after it is
+//                     allocated.
+//
+// Assumptions:
+//      -Memory from new is only given back with delete (and from malloc
+//       only with free), as the language requires.
+//      -A scope is never held across a co_await, or the tag would follow
+//       the thread to whichever coroutine it resumes next.
+//
+// Dependencies: None
+//
+
+const int ALLOC_UNTAGGED = 0;      //Anything not inside a scope
+const int ALLOC_DICTIONARY = 1;    //Building the dictionary
+const int ALLOC_CORPUS_BUILD = 2;  //Building a corpus and its ambiguity
+const int ALLOC_PUZZLE_POOL = 3;   //The pool generating fresh puzzles
+const int ALLOC_ROUND = 4;         //Drawing and showing a round's puzzle
+const int ALLOC_GRADING = 5;       //Grading guesses and records
+const int NUM_ALLOC_TAGS = 6;
+
+struct AllocationCounts {
+    uint64_t allocations;
+    uint64_t bytes;           //Requested, not counting the tracker's own
+    uint64_t frees;
+    uint64_t freedBytes;
+};
+
+struct AllocationStats {
+    AllocationCounts byTag[NUM_ALLOC_TAGS];
+    AllocationCounts total;
+};
+
+class AllocationTracker {
+public:
+    static bool isEnabled(void);
+    //Description: Returns true if this build was compiled with
+    //             P4_TRACK_ALLOCATIONS
+
+    static int setTag(int tag);
+    //Description: Makes tag the calling thread's current tag and returns the
+    //             one it replaces
+    //Preconditions: 0 <= tag < NUM_ALLOC_TAGS
+
+    static void snapshot(AllocationStats& stats);
+    //Description: Replaces stats with every thread's counts so far (all
+    //             zeroes if tracking isn't compiled in). Allocations made
+    //             while this runs may or may not be included.
+
+    static const char * tagName(int tag);
+    //Description: Returns the name the report uses for the tag
+
+    static void report(std::ostream& out);
+    //Description: Prints a line per tag with its allocations, bytes, frees
+    //             and the bytes still live
+};
+
+//Charges the allocations made in the scope it is declared in to a tag
+#ifdef P4_TRACK_ALLOCATIONS
+class AllocationScope {
+private:
+    int previous;
+
+    AllocationScope(const AllocationScope&);
+    AllocationScope& operator=(const AllocationScope&);
+public:
+    explicit AllocationScope(int tag)
+    : previous(AllocationTracker::setTag(tag)) {}
+    ~AllocationScope(void) {
+        AllocationTracker::setTag(this->previous);
+    }
+};
+#else
+class AllocationScope {
+public:
+    explicit AllocationScope(int) {}
+};
+#endif
+
+#endif /* AllocationTracker_h */
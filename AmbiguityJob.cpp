@@ -0,0 +1,162 @@
+// Author: Forrest Miller
+// Filename: AmbiguityJob.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "AmbiguityJob.h"
+#include "AllocationTracker.h"
+#include <thread>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the AmbiguityJob
+//          class. Each bucket starts out as a single task. Workers pop from
+//          the back of their own deque and thieves take from the front, so the
+//          largest unsplit ranges are the ones that get stolen.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+//   Implementation Invariants:
+//        puzzlesRemaining only reaches 0 once every puzzle has been given its
+//          count, which is what lets idle workers know they can stop.
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const unsigned long PUZZLES_PER_GRAIN = 8ul; //Ranges this small are not split
+const unsigned int SINGLE_WORKER = 1u;
+const unsigned int ONE_ANSWER = 1u;
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+AmbiguityJob::AmbiguityJob(const Dictionary& dict, unsigned int workers)
+: dictionary(dict) {
+    if (0u == workers) {
+        workers = std::thread::hardware_concurrency();
+    }
+    if (workers < SINGLE_WORKER) {
+        workers = SINGLE_WORKER; //hardware_concurrency() may report 0
+    }
+    this->workerCount = workers;
+    this->puzzleBuckets = nullptr;
+    this->puzzlesRemaining = 0ul;
+    this->ambiguousPuzzles = 0ul;
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+unsigned long AmbiguityJob::run(std::vector<SequenceEnum *> * buckets[],
+                                unsigned long numBuckets) {
+    this->puzzleBuckets = buckets;
+    this->queues = std::vector<WorkQueue>(this->workerCount);
+    this->ambiguousPuzzles = 0ul;
+
+    //Deal out one task per bucket, round robin across the workers
+    unsigned long totalPuzzles = 0ul;
+    unsigned int nextQueue = 0u;
+    for (unsigned long len = 0ul; len < numBuckets; len++) {
+        if (nullptr == buckets[len] || buckets[len]->empty()) {
+            continue;
+        }
+        Task t = { len, 0ul, (unsigned long) buckets[len]->size() };
+        this->queues[nextQueue].tasks.push_back(t);
+        nextQueue = (nextQueue + 1u) % this->workerCount;
+        totalPuzzles += t.end;
+    }
+    this->puzzlesRemaining = totalPuzzles;
+
+    std::vector<std::thread> helpers;
+    for (unsigned int id = SINGLE_WORKER; id < this->workerCount; id++) {
+        helpers.push_back(std::thread(&AmbiguityJob::workerLoop, this, id));
+    }
+    workerLoop(0u); //The calling thread works too
+    for (std::thread& t : helpers) {
+        t.join();
+    }
+    return this->ambiguousPuzzles.load();
+}
+
+unsigned int AmbiguityJob::countPossibleAnswers(const SequenceEnum& puzzle,
+                                                const Dictionary& dict) {
+    //Every transform is only ever applied to words of the bucket's length, and
+    //the emitted word's length doesn't tell us that length, so ask the puzzle
+    unsigned int possibleAnswers = 0u;
+    const std::vector<std::string>& candidates =
+                                dict.getWordsOfLength(puzzle.getWordLength());
+    for (const std::string& candidate : candidates) {
+        if (puzzle.couldBeEncryptionOf(candidate)) {
+            possibleAnswers++;
+        }
+    }
+    return possibleAnswers;
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+void AmbiguityJob::workerLoop(unsigned int workerId) {
+    AllocationScope scope(ALLOC_CORPUS_BUILD);
+    Task task;
+    while (this->puzzlesRemaining.load() > 0ul) {
+        if (!popOwnTask(workerId, task) && !stealTask(workerId, task)) {
+            //Everything left is being worked on by someone else, but they may
+            //still split off more work, so don't quit until it is all done
+            std::this_thread::yield();
+            continue;
+        }
+        //Keep splitting off the upper half so other workers can steal it
+        while (task.end - task.begin > PUZZLES_PER_GRAIN) {
+            unsigned long middle = task.begin + (task.end - task.begin) / 2ul;
+            Task upperHalf = { task.length, middle, task.end };
+            {
+                std::lock_guard<std::mutex> guard(this->queues[workerId].lock);
+                this->queues[workerId].tasks.push_back(upperHalf);
+            }
+            task.end = middle;
+        }
+        processTask(task);
+    }
+}
+
+bool AmbiguityJob::popOwnTask(unsigned int workerId, Task& task) {
+    WorkQueue& own = this->queues[workerId];
+    std::lock_guard<std::mutex> guard(own.lock);
+    if (own.tasks.empty()) {
+        return false;
+    }
+    task = own.tasks.back();
+    own.tasks.pop_back();
+    return true;
+}
+
+bool AmbiguityJob::stealTask(unsigned int thiefId, Task& task) {
+    for (unsigned int offset = 1u; offset < this->workerCount; offset++) {
+        unsigned int victimId = (thiefId + offset) % this->workerCount;
+        WorkQueue& victim = this->queues[victimId];
+        std::lock_guard<std::mutex> guard(victim.lock);
+        if (!victim.tasks.empty()) {
+            task = victim.tasks.front();
+            victim.tasks.pop_front();
+            return true;
+        }
+    }
+    return false;
+}
+
+void AmbiguityJob::processTask(const Task& task) {
+    std::vector<SequenceEnum *>& bucket = *(this->puzzleBuckets[task.length]);
+    unsigned long ambiguousInTask = 0ul;
+    for (unsigned long i = task.begin; i < task.end; i++) {
+        unsigned int possibleAnswers =
+                           countPossibleAnswers(*bucket[i], this->dictionary);
+        bucket[i]->setAmbiguityCount(possibleAnswers);
+        if (possibleAnswers > ONE_ANSWER) {
+            ambiguousInTask++;
+        }
+    }
+    this->ambiguousPuzzles += ambiguousInTask;
+    this->puzzlesRemaining -= (task.end - task.begin);
+}
@@ -0,0 +1,100 @@
+// Author: Forrest Miller
+// Filename: AmbiguityJob.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef AmbiguityJob_h
+#define AmbiguityJob_h
+
+#include "SequenceEnum.h"
+#include "Dictionary.h"
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <vector>
+
+//
+// Class Overview:
+//     This class runs the offline job that finds out, for every generated
+//     puzzle, how many dictionary words could have produced it. A puzzle whose
+//     count is greater than 1 has more than one valid answer, yet guessWord()
+//     will only accept one of them. The count is stored on the puzzle itself
+//     (see SequenceEnum::setAmbiguityCount) so the game can filter or weight
+//     puzzles without doing any work at serve time.
+//
+//     The cost of a puzzle depends on the number of dictionary words sharing
+//     its length, which varies from a dozen to nearly two thousand, so the
+//     work is spread across threads with work stealing: every worker owns a
+//     deque of index ranges, splits large ranges in half (keeping one half on
+//     its own deque) and steals from the other end of another worker's deque
+//     when it runs dry.
+//
+// Valid States include: The object is valid once constructed. run() may be
+//                       called any number of times.
+//
+// Anticipated Use:  Called once during initialization after every puzzle in
+//                   the wordHolder buckets has been constructed and before
+//                   the game begins.
+//
+// Class Invariants:  -The dictionary reference must outlive the job.
+//                    -Each puzzle is processed by exactly one worker per run,
+//                     so puzzles are never written to concurrently.
+//
+// Assumptions:
+//      -Bucket N holds puzzles built from N-letter words, matching the
+//       dictionary's length buckets.
+//      -No other thread touches the puzzles while run() is executing.
+//
+// Dependencies: SequenceEnum, Dictionary
+//
+
+class AmbiguityJob {
+private:
+    struct Task {
+        unsigned long length; //Word length, which is also the bucket index
+        unsigned long begin;  //First puzzle index in the bucket
+        unsigned long end;    //One past the last puzzle index
+    };
+    struct WorkQueue {
+        std::mutex lock;
+        std::deque<Task> tasks;
+    };
+
+    const Dictionary& dictionary;
+    unsigned int workerCount;
+    std::vector<SequenceEnum *> * const * puzzleBuckets;
+    std::vector<WorkQueue> queues;
+    std::atomic<unsigned long> puzzlesRemaining;
+    std::atomic<unsigned long> ambiguousPuzzles;
+
+    void workerLoop(unsigned int workerId);
+    bool popOwnTask(unsigned int workerId, Task&);
+    bool stealTask(unsigned int thiefId, Task&);
+    void processTask(const Task&);
+public:
+    AmbiguityJob(const Dictionary&, unsigned int workerCount = 0u);
+    //Description: Constructs the job. A worker count of 0 uses one worker per
+    //             hardware thread.
+    //Preconditions: The dictionary must outlive this object
+    //Postconditions: Object is ready to run
+
+    unsigned long run(std::vector<SequenceEnum *> * buckets[],
+                      unsigned long numBuckets);
+    //Description: Computes and stores the ambiguity count of every puzzle in
+    //             the buckets. Null buckets are skipped. Blocks until every
+    //             puzzle has been processed.
+    //Preconditions: buckets must hold numBuckets pointers, bucket N holding
+    //               puzzles of N-letter words
+    //Postconditions: Every puzzle's getAmbiguityCount() is up to date. Returns
+    //                the number of puzzles with more than one valid answer.
+
+    static unsigned int countPossibleAnswers(const SequenceEnum&,
+                                             const Dictionary&);
+    //Description: Returns how many dictionary words of the puzzle's length
+    //             could have produced what the puzzle currently emits. Does
+    //             not store the count on the puzzle.
+    //Preconditions: None
+    //Postconditions: None
+};
+
+#endif /* AmbiguityJob_h */
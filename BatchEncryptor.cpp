@@ -0,0 +1,82 @@
+// Author: Forrest Miller
+// Filename: BatchEncryptor.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "BatchEncryptor.h"
+#include "PuzzleFactory.h"
+#include <cctype>
+#include <string>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the BatchEncryptor
+//          class.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const size_t MIN_PUZZLE_WORD_LETTERS = 3u;
+const double BYTES_PER_MEGABYTE = 1048576.0;
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+BatchEncryptor::BatchEncryptor(int chosenVariant) {
+    this->variant = chosenVariant;
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+int BatchEncryptor::appendRecord(const char * word, size_t length,
+                                 OutputBuffer& out) const {
+    if (!isPuzzleWord(word, length)) {
+        return WORD_SKIPPED;
+    }
+    int recordVariant = this->variant;
+    if (RANDOM_VARIANT == recordVariant) {
+        recordVariant = PuzzleFactory::randomVariant();
+    }
+    std::string lowercase(word, length); //The puzzle comes out lowercase too
+    for (char& letter : lowercase) {
+        letter = (char) std::tolower((unsigned char) letter);
+    }
+    std::string encrypted = PuzzleFactory::encryptWord(lowercase,
+                                                       recordVariant);
+    out.append(lowercase);
+    out.append('\t');
+    out.append(encrypted);
+    out.append('\t');
+    out.append(PuzzleFactory::variantName(recordVariant));
+    out.append('\n');
+    return WORD_ENCRYPTED;
+}
+
+void BatchEncryptor::report(const BatchTally& tally, double seconds,
+                            std::ostream& out) const {
+    unsigned long words = tally.outcomes[WORD_ENCRYPTED];
+    out << "Encrypted " << words << " words (skipped "
+    << tally.outcomes[WORD_SKIPPED] << ") in " << seconds << " seconds";
+    if (seconds > 0.0) {
+        out << ": " << (double) words / seconds << " words/sec, "
+        << (double) tally.outputBytes / BYTES_PER_MEGABYTE / seconds
+        << " MB/sec written";
+    }
+    out << std::endl;
+}
+
+bool BatchEncryptor::isPuzzleWord(const char * word, size_t length) {
+    if (length < MIN_PUZZLE_WORD_LETTERS) {
+        return false;
+    }
+    for (size_t i = 0u; i < length; i++) {
+        if (!std::isalpha((unsigned char) word[i])) {
+            return false;
+        }
+    }
+    return true;
+}
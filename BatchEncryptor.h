@@ -0,0 +1,66 @@
+// Author: Forrest Miller
+// Filename: BatchEncryptor.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef BatchEncryptor_h
+#define BatchEncryptor_h
+
+#include "RecordProcessor.h"
+
+//
+// Class Overview:
+//     This class turns a word list into a puzzle pack without the game:
+//     every word is encrypted with the chosen SequenceEnum variant (or one
+//     picked at random per word) and written out as a tab separated record,
+//        original<TAB>encrypted<TAB>transform
+//     where transform is the variant's class name. Reading the words and
+//     writing the records in large blocks is left to RecordProcessor (or
+//     RecordPipeline), so the run is limited by the disk and not by per-word
+//     I/O calls.
+//     Words are written lowercase, as the puzzles are. Words the puzzles
+//     can't take (shorter than 3 letters, or holding anything other than
+//     letters) are skipped and counted.
+//
+// Valid States include: The class holds only the variant to use.
+//
+// Anticipated Use:  Run from main() with --encrypt.
+//
+// Class Invariants:  None
+//
+// Assumptions:
+//      -Every thread that encrypts has its own SequenceEnum random source.
+//
+// Dependencies: RecordProcessor, PuzzleFactory
+//
+
+const int WORD_ENCRYPTED = 0; //Outcomes counted in a BatchTally
+const int WORD_SKIPPED = 1;
+
+class BatchEncryptor : public RecordProcessor {
+private:
+    int variant;
+public:
+    BatchEncryptor(int variant);
+    //Description: Constructs an encryptor for one variant (DO_SEQ_ENUM,
+    //             DO_SEQ_EXTRACT, DO_SPAS_ENUM or RANDOM_VARIANT)
+    //Preconditions: None
+    //Postconditions: None
+
+    int appendRecord(const char * word, size_t length,
+                     OutputBuffer& out) const override;
+    //Description: Encrypts one word and appends its record
+    //Preconditions: None
+    //Postconditions: Returns WORD_SKIPPED (appending nothing) if the word
+    //                can't be made into a puzzle, WORD_ENCRYPTED otherwise
+
+    void report(const BatchTally& tally, double seconds,
+                std::ostream& out) const override;
+    //Description: Prints how many words were encrypted and how fast
+
+    static bool isPuzzleWord(const char * word, size_t length);
+    //Description: Returns true for words of 3 or more letters and nothing
+    //             else
+};
+
+#endif /* BatchEncryptor_h */
@@ -0,0 +1,367 @@
+// Author: Forrest Miller
+// Filename: BenchComparator.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "BenchComparator.h"
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <math.h>
+#include <sstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the
+//          BenchComparator class. The reader doesn't parse JSON in general,
+//          only what BenchRunner writes: it looks for the environment's
+//          strings by key, then for each benchmark's "name" followed by its
+//          "nsPerOp" list.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const int COMPARE_LINE_BYTES = 160;
+const char * const VERDICT_NAMES[] = {"same", "REGRESSED", "improved",
+    "MISSING from candidate", "only in candidate"};
+const char * const NAME_KEY = "\"name\":";
+const char * const TIMES_KEY = "\"nsPerOp\":";
+
+//Reads the JSON string starting at the quote at 'at', leaving 'at' past it
+static bool readString(const std::string& text, size_t& at,
+                       std::string& value) {
+    at = text.find('"', at);
+    if (std::string::npos == at) {
+        return false;
+    }
+    value.clear();
+    for (at++; at < text.length() && '"' != text[at]; at++) {
+        if ('\\' == text[at] && at + 1u < text.length()) {
+            at++;
+        }
+        value += text[at];
+    }
+    at++;
+    return at <= text.length();
+}
+
+//Returns the string value of the first "key" in the text, or "unknown"
+static std::string readField(const std::string& text, const char * key) {
+    std::string value = "unknown";
+    size_t at = text.find(std::string("\"") + key + "\":");
+    if (std::string::npos != at) {
+        at += strlen(key) + 3u;
+        readString(text, at, value);
+    }
+    return value;
+}
+
+//Returns the unquoted value (a number) of the first "key" in the text, or
+//"unknown"
+static std::string readNumberField(const std::string& text,
+                                   const char * key) {
+    size_t at = text.find(std::string("\"") + key + "\":");
+    if (std::string::npos == at) {
+        return "unknown";
+    }
+    at = text.find_first_not_of(' ', at + strlen(key) + 3u);
+    size_t end = text.find_first_of(",}", at);
+    if (std::string::npos == at || std::string::npos == end) {
+        return "unknown";
+    }
+    return text.substr(at, end - at);
+}
+
+static double median(std::vector<double> values) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    std::sort(values.begin(), values.end());
+    size_t middle = values.size() / 2u;
+    if (0u == values.size() % 2u) {
+        return (values[middle - 1u] + values[middle]) / 2.0;
+    }
+    return values[middle];
+}
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+BenchComparator::BenchComparator(double threshold) {
+    this->thresholdPercent = threshold;
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+bool BenchComparator::load(const std::string& baselinePath,
+                           const std::string& candidatePath) {
+    return readRun(baselinePath, this->baseline) &&
+           readRun(candidatePath, this->candidate);
+}
+
+void BenchComparator::compare(void) {
+    this->comparisons.clear();
+    std::vector<bool> matched(this->candidate.names.size(), false);
+    for (size_t i = 0u; i < this->baseline.names.size(); i++) {
+        BenchComparison result;
+        result.name = this->baseline.names[i];
+        result.baselineMedian = median(this->baseline.nsPerOp[i]);
+        result.candidateMedian = 0.0;
+        result.changePercent = 0.0;
+        result.pValue = 1.0;
+        result.verdict = BENCH_ONLY_BASELINE;
+        for (size_t j = 0u; j < this->candidate.names.size(); j++) {
+            if (matched[j] || this->candidate.names[j] != result.name) {
+                continue;
+            }
+            matched[j] = true;
+            const std::vector<double>& times = this->candidate.nsPerOp[j];
+            result.candidateMedian = median(times);
+            if (result.baselineMedian > 0.0) {
+                result.changePercent = 100.0 * (result.candidateMedian -
+                                       result.baselineMedian) /
+                                       result.baselineMedian;
+            }
+            result.pValue = mannWhitneyP(this->baseline.nsPerOp[i], times);
+            bool significant = result.pValue < BENCH_SIGNIFICANCE_LEVEL;
+            result.verdict = BENCH_SAME;
+            if (significant && result.changePercent > this->thresholdPercent) {
+                result.verdict = BENCH_REGRESSED;
+            }
+            else if (significant &&
+                     result.changePercent < -this->thresholdPercent) {
+                result.verdict = BENCH_IMPROVED;
+            }
+            break;
+        }
+        this->comparisons.push_back(result);
+    }
+    for (size_t j = 0u; j < this->candidate.names.size(); j++) {
+        if (!matched[j]) {
+            BenchComparison result = {this->candidate.names[j], 0.0,
+                median(this->candidate.nsPerOp[j]), 0.0, 1.0,
+                BENCH_ONLY_CANDIDATE};
+            this->comparisons.push_back(result);
+        }
+    }
+}
+
+bool BenchComparator::anyRegressed(void) const {
+    for (const BenchComparison& result : this->comparisons) {
+        if (BENCH_REGRESSED == result.verdict) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool BenchComparator::anyMissing(void) const {
+    for (const BenchComparison& result : this->comparisons) {
+        if (BENCH_ONLY_BASELINE == result.verdict) {
+            return true;
+        }
+    }
+    return false;
+}
+
+const std::vector<BenchComparison>& BenchComparator::getComparisons(void)
+const {
+    return this->comparisons;
+}
+
+void BenchComparator::report(std::ostream& out) const {
+    if (this->baseline.compiler != this->candidate.compiler ||
+        this->baseline.switches != this->candidate.switches ||
+        this->baseline.cpu != this->candidate.cpu) {
+        out << "Warning: the runs come from different builds or machines\n"
+        "  baseline:  " << this->baseline.compiler << " [" <<
+        this->baseline.switches << "] on " << this->baseline.cpu << "\n"
+        "  candidate: " << this->candidate.compiler << " [" <<
+        this->candidate.switches << "] on " << this->candidate.cpu << "\n";
+    }
+    if (this->baseline.seed != this->candidate.seed) {
+        out << "Warning: the runs used different seeds (" <<
+        this->baseline.seed << " and " << this->candidate.seed << "), so "
+        "they timed different random transforms\n";
+    }
+    char line[COMPARE_LINE_BYTES];
+    snprintf(line, sizeof(line), "%-24s %11s %11s %8s %8s  %s\n",
+             "Benchmark", "base ns/op", "new ns/op", "change", "p",
+             "verdict");
+    out << line;
+    for (const BenchComparison& result : this->comparisons) {
+        snprintf(line, sizeof(line), "%-24s %11.1f %11.1f %+7.1f%% %8.4f  %s\n",
+                 result.name.c_str(), result.baselineMedian,
+                 result.candidateMedian, result.changePercent, result.pValue,
+                 VERDICT_NAMES[result.verdict]);
+        out << line;
+    }
+    snprintf(line, sizeof(line), "Threshold %.1f%%, significance p < %.2f\n",
+             this->thresholdPercent, BENCH_SIGNIFICANCE_LEVEL);
+    out << line;
+    if (anyMissing()) {
+        out << "Error: the candidate is missing benchmarks the baseline has "
+        "(did its run stop part way?)\n";
+    }
+    out.flush();
+}
+
+bool BenchComparator::readRun(const std::string& path, BenchRun& run) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Could not read benchmark results " << path << std::endl;
+        return false;
+    }
+    std::stringstream contents;
+    contents << file.rdbuf();
+    std::string text = contents.str();
+    if (!isComplete(text)) {
+        std::cerr << "Benchmark results " << path << " are cut short or not "
+        "JSON" << std::endl;
+        return false;
+    }
+    run.compiler = readField(text, "compiler");
+    run.switches = readField(text, "switches");
+    run.cpu = readField(text, "cpu");
+    run.seed = readNumberField(text, "seed");
+    run.names.clear();
+    run.nsPerOp.clear();
+    size_t at = text.find("\"benchmarks\"");
+    while (std::string::npos != at &&
+           std::string::npos != (at = text.find(NAME_KEY, at))) {
+        at += strlen(NAME_KEY);
+        std::string name;
+        size_t times = text.find(TIMES_KEY, at);
+        if (!readString(text, at, name) || std::string::npos == times) {
+            break;
+        }
+        at = text.find('[', times);
+        if (std::string::npos == at) {
+            break;
+        }
+        std::vector<double> values;
+        const char * cursor = text.c_str() + at + 1u;
+        while (true) {
+            char * end;
+            double value = strtod(cursor, &end);
+            if (end == cursor) {
+                break;
+            }
+            values.push_back(value);
+            cursor = end;
+            while (' ' == *cursor || ',' == *cursor) {
+                cursor++;
+            }
+        }
+        at = (size_t) (cursor - text.c_str());
+        if (values.empty() || ']' != *cursor) {
+            std::cerr << "Benchmark " << name << " in " << path << " has no "
+            "times, or something other than numbers in them" << std::endl;
+            return false;
+        }
+        run.names.push_back(name);
+        run.nsPerOp.push_back(values);
+    }
+    if (run.names.empty()) {
+        std::cerr << "No benchmark results in " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+//Tracks the open lists and objects outside of strings; the text is complete
+//when the first one opened has been closed, with only spaces after it
+bool BenchComparator::isComplete(const std::string& text) {
+    std::string open;
+    bool inString = false;
+    size_t at = text.find_first_not_of(" \t\r\n");
+    if (std::string::npos == at || ('{' != text[at] && '[' != text[at])) {
+        return false;
+    }
+    for (; at < text.length(); at++) {
+        char c = text[at];
+        if (inString) {
+            if ('\\' == c) {
+                at++;
+            }
+            else if ('"' == c) {
+                inString = false;
+            }
+        }
+        else if ('"' == c) {
+            inString = true;
+        }
+        else if ('{' == c || '[' == c) {
+            open += c;
+        }
+        else if ('}' == c || ']' == c) {
+            if (open.empty() || open.back() != ('}' == c ? '{' : '[')) {
+                return false;
+            }
+            open.pop_back();
+            if (open.empty()) {
+                break;
+            }
+        }
+    }
+    return open.empty() && !inString && at < text.length() &&
+           std::string::npos == text.find_first_not_of(" \t\r\n", at + 1u);
+}
+
+//Ranks both samples together (ties share the average of their ranks) and
+//compares the first sample's rank sum with what it would be by chance
+double BenchComparator::mannWhitneyP(const std::vector<double>& first,
+                                     const std::vector<double>& second) {
+    size_t n1 = first.size();
+    size_t n2 = second.size();
+    if (n1 < 2u || n2 < 2u) {
+        return 1.0;
+    }
+    std::vector<std::pair<double, int> > pooled;
+    for (double value : first) {
+        pooled.push_back(std::make_pair(value, 0));
+    }
+    for (double value : second) {
+        pooled.push_back(std::make_pair(value, 1));
+    }
+    std::sort(pooled.begin(), pooled.end());
+    double n = (double) pooled.size();
+    double firstRankSum = 0.0;
+    double tieTerm = 0.0; //Sum of t^3 - t over each group of t ties
+    for (size_t i = 0u; i < pooled.size(); ) {
+        size_t j = i;
+        while (j < pooled.size() && pooled[j].first == pooled[i].first) {
+            j++;
+        }
+        double rank = ((double) (i + 1u) + (double) j) / 2.0;
+        for (size_t k = i; k < j; k++) {
+            if (0 == pooled[k].second) {
+                firstRankSum += rank;
+            }
+        }
+        double ties = (double) (j - i);
+        tieTerm += ties * ties * ties - ties;
+        i = j;
+    }
+    double u = firstRankSum - (double) n1 * ((double) n1 + 1.0) / 2.0;
+    double mean = (double) n1 * (double) n2 / 2.0;
+    double variance = (double) n1 * (double) n2 / 12.0 *
+                      ((n + 1.0) - tieTerm / (n * (n - 1.0)));
+    if (variance <= 0.0) {
+        return 1.0; //Every value is the same
+    }
+    //Half a step towards the mean for continuity
+    double distance = fabs(u - mean) - 0.5;
+    if (distance < 0.0) {
+        distance = 0.0;
+    }
+    double z = distance / sqrt(variance);
+    return erfc(z / sqrt(2.0));
+}
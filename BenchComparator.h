@@ -0,0 +1,131 @@
+// Author: Forrest Miller
+// Filename: BenchComparator.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef BenchComparator_h
+#define BenchComparator_h
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+//
+// Class Overview:
+//     This class compares two benchmark runs written with --bench-json, so a
+//     build can be checked against an earlier one. For every benchmark in
+//     both runs it compares the medians, and decides whether the difference
+//     is real or noise with a two-sided Mann-Whitney U test over the
+//     repetitions' times. The test only looks at which run's repetitions
+//     rank faster, so a single slow outlier can't make or hide a regression.
+//     A benchmark has regressed when its median got slower by more than the
+//     threshold and the test says the runs differ (p below
+//     BENCH_SIGNIFICANCE_LEVEL). It has improved on the same terms the other
+//     way round. A benchmark the candidate doesn't have is missing, and
+//     fails the comparison just as a regression does, since a run that
+//     crashed part way would otherwise pass. A file that is cut short (any
+//     list or object left open) isn't read at all.
+//
+// Valid States include: Empty, loaded (holding both runs), and compared.
+//
+// Anticipated Use:  main() loads the two files given to --compare, compares
+//                   them, prints the report, and exits non-zero if anything
+//                   regressed or is missing.
+//
+// Class Invariants:  -Comparisons are in the order of the baseline's
+//                     benchmarks, followed by any only the candidate has.
+//
+// Assumptions:
+//      -Files were written by BenchRunner::writeJson(); anything else that
+//       is complete JSON is read only as far as it looks like one.
+//      -The normal approximation of U (with the correction for ties) is
+//       close enough from about 5 repetitions per run.
+//
+// Dependencies: None
+//
+
+const double DEFAULT_REGRESSION_THRESHOLD = 5.0; //Percent
+const double BENCH_SIGNIFICANCE_LEVEL = 0.05;
+
+const int BENCH_SAME = 0;
+const int BENCH_REGRESSED = 1;
+const int BENCH_IMPROVED = 2;
+const int BENCH_ONLY_BASELINE = 3;
+const int BENCH_ONLY_CANDIDATE = 4;
+
+struct BenchRun {
+    std::string compiler;
+    std::string switches;
+    std::string cpu;
+    std::string seed;
+    std::vector<std::string> names;
+    std::vector<std::vector<double> > nsPerOp; //One list per benchmark
+};
+
+struct BenchComparison {
+    std::string name;
+    double baselineMedian;
+    double candidateMedian;
+    double changePercent;   //Positive is slower
+    double pValue;
+    int verdict;            //BENCH_SAME, BENCH_REGRESSED, ...
+};
+
+class BenchComparator {
+private:
+    double thresholdPercent;
+    BenchRun baseline;
+    BenchRun candidate;
+    std::vector<BenchComparison> comparisons;
+
+    BenchComparator(const BenchComparator&);
+    BenchComparator& operator=(const BenchComparator&);
+public:
+    explicit BenchComparator(double thresholdPercent);
+    //Description: Constructs an empty comparator that flags changes bigger
+    //             than thresholdPercent
+    //Preconditions: thresholdPercent is not negative
+
+    bool load(const std::string& baselinePath,
+              const std::string& candidatePath);
+    //Description: Reads both runs
+    //Postconditions: Returns false (after printing why) if either file can't
+    //                be read, is cut short or holds no benchmarks
+
+    void compare(void);
+    //Description: Compares every benchmark, replacing any earlier comparison
+    //Preconditions: Loaded
+
+    bool anyRegressed(void) const;
+    //Description: Returns true if any benchmark regressed
+
+    bool anyMissing(void) const;
+    //Description: Returns true if any baseline benchmark is not in the
+    //             candidate
+
+    const std::vector<BenchComparison>& getComparisons(void) const;
+    //Description: Returns the comparisons from the last compare()
+
+    void report(std::ostream& out) const;
+    //Description: Prints a line per benchmark with both medians, the change,
+    //             p and the verdict, after a warning if the two runs came
+    //             from different compilers, switches or CPUs or used
+    //             different seeds, and ends with a warning if any benchmark
+    //             is missing from the candidate
+
+    static bool readRun(const std::string& path, BenchRun& run);
+    //Description: Reads one run written by BenchRunner::writeJson()
+    //Postconditions: Returns false (after printing why) if the file can't
+    //                be read, is cut short or holds no benchmarks
+
+    static bool isComplete(const std::string& text);
+    //Description: Returns true if the text is one JSON object or array with
+    //             every list and object in it closed
+
+    static double mannWhitneyP(const std::vector<double>& first,
+                               const std::vector<double>& second);
+    //Description: Returns the two-sided p value of the Mann-Whitney U test,
+    //             or 1 if either sample has fewer than 2 values
+};
+
+#endif /* BenchComparator_h */
@@ -0,0 +1,373 @@
+// Author: Forrest Miller
+// Filename: BenchRunner.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "BenchRunner.h"
+#include "PuzzleFactory.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <stdio.h>
+#include <string.h>
+#include <sys/utsname.h>
+#include <thread>
+#include <time.h>
+#include <unistd.h>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the BenchRunner
+//          class. Every benchmark body loops over its operations itself, so
+//          the call through std::function is paid once per repetition and
+//          not once per operation. Each body sums what its operations return
+//          and stores the sum to a volatile, so the compiler can't drop the
+//          work being timed.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const double BENCH_NANOS_PER_SECOND = 1e9;
+const int BENCH_ROW_BYTES = 160;
+const int BENCH_HOST_BYTES = 256;
+const int BENCH_TIME_BYTES = 32;
+const char * const CPU_INFO_PATH = "/proc/cpuinfo";
+const char * const CPU_MODEL_KEY = "model name";
+
+static volatile unsigned long benchSink = 0ul;
+
+static double median(std::vector<double> values) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    std::sort(values.begin(), values.end());
+    size_t middle = values.size() / 2;
+    if (0u == values.size() % 2) {
+        return (values[middle - 1] + values[middle]) / 2.0;
+    }
+    return values[middle];
+}
+
+//Quotes a string for JSON
+static std::string quoted(const std::string& text) {
+    std::string out = "\"";
+    for (char c : text) {
+        if ('"' == c || '\\' == c) {
+            out += '\\';
+        }
+        if ((unsigned char) c >= ' ') { //Control characters are dropped
+            out += c;
+        }
+    }
+    return out + "\"";
+}
+
+static std::string cpuModel(void) {
+    std::ifstream cpuInfo(CPU_INFO_PATH);
+    std::string line;
+    while (std::getline(cpuInfo, line)) {
+        if (0 == line.compare(0, strlen(CPU_MODEL_KEY), CPU_MODEL_KEY)) {
+            size_t colon = line.find(':');
+            if (std::string::npos != colon && colon + 2u <= line.length()) {
+                return line.substr(colon + 2u);
+            }
+        }
+    }
+    return "unknown";
+}
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+BenchRunner::BenchRunner(const std::vector<std::string>& benchWords,
+                         int reps, bool perf, uint64_t seed)
+: words(benchWords), rng(seed) {
+    this->seed = seed;
+    this->repetitions = reps;
+    this->usePerf = perf;
+    SequenceEnum::setThreadRandomSource(&this->rng);
+    for (const std::string& word : this->words) {
+        this->seqEnums.push_back(PuzzleFactory::makeVariant(word,
+                                                            DO_SEQ_ENUM));
+        this->seqExtracts.push_back(static_cast<SeqExtract *>(
+                            PuzzleFactory::makeVariant(word, DO_SEQ_EXTRACT)));
+        this->spasEnums.push_back(static_cast<SpasEnum *>(
+                            PuzzleFactory::makeVariant(word, DO_SPAS_ENUM)));
+    }
+    SequenceEnum::setThreadRandomSource(nullptr);
+}
+
+BenchRunner::~BenchRunner(void) {
+    for (size_t i = 0u; i < this->words.size(); i++) {
+        delete this->seqEnums[i];
+        delete this->seqExtracts[i];
+        delete this->spasEnums[i];
+    }
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+void BenchRunner::run(void) {
+    this->results.clear();
+    PerfCounters counters;
+    if (this->usePerf) {
+        counters.open();
+    }
+    SequenceEnum::setThreadRandomSource(&this->rng);
+    const std::vector<std::string>& wordList = this->words;
+    const size_t count = wordList.size();
+
+    //Building a puzzle from nothing, for each class
+    for (int variant = 0; variant < SEQ_ENUM_VARIANTS; variant++) {
+        runOne(std::string(PuzzleFactory::variantName(variant)) +
+               "/construct", [&wordList, count, variant](unsigned long ops) {
+            size_t w = 0u;
+            unsigned long sum = 0ul;
+            for (unsigned long i = 0ul; i < ops; i++) {
+                sum += PuzzleFactory::encryptWord(wordList[w],
+                                                  variant).length();
+                w = (w + 1u == count) ? 0u : w + 1u;
+            }
+            benchSink = sum;
+        }, counters);
+    }
+    //Re-randomizing an existing puzzle (turning the transform off and on
+    //again redoes it)
+    runOne("SequenceEnum/regenerate", [this, count](unsigned long ops) {
+        size_t w = 0u;
+        unsigned long sum = 0ul;
+        for (unsigned long i = 0ul; i < ops; i++) {
+            sum += this->seqEnums[w]->setNewSeqEnum().length();
+            w = (w + 1u == count) ? 0u : w + 1u;
+        }
+        benchSink = sum;
+    }, counters);
+    runOne("SeqExtract/regenerate", [this, count](unsigned long ops) {
+        size_t w = 0u;
+        unsigned long sum = 0ul;
+        for (unsigned long i = 0ul; i < ops; i++) {
+            this->seqExtracts[w]->toggleSeqExtractActivation();
+            sum += this->seqExtracts[w]->toggleSeqExtractActivation();
+            w = (w + 1u == count) ? 0u : w + 1u;
+        }
+        benchSink = sum;
+    }, counters);
+    runOne("SpasEnum/regenerate", [this, count](unsigned long ops) {
+        size_t w = 0u;
+        unsigned long sum = 0ul;
+        for (unsigned long i = 0ul; i < ops; i++) {
+            this->spasEnums[w]->toggleSpasEnumActivation();
+            sum += this->spasEnums[w]->toggleSpasEnumActivation();
+            w = (w + 1u == count) ? 0u : w + 1u;
+        }
+        benchSink = sum;
+    }, counters);
+
+    //The accessors a round calls, through the base class like the game does
+    const std::vector<SequenceEnum *> byVariant[SEQ_ENUM_VARIANTS] = {
+        this->seqEnums,
+        std::vector<SequenceEnum *>(this->seqExtracts.begin(),
+                                    this->seqExtracts.end()),
+        std::vector<SequenceEnum *>(this->spasEnums.begin(),
+                                    this->spasEnums.end())};
+    for (int variant = 0; variant < SEQ_ENUM_VARIANTS; variant++) {
+        const std::vector<SequenceEnum *>& puzzles = byVariant[variant];
+        std::string name = PuzzleFactory::variantName(variant);
+        runOne(name + "/emitWord", [&puzzles, count](unsigned long ops) {
+            size_t w = 0u;
+            unsigned long sum = 0ul;
+            for (unsigned long i = 0ul; i < ops; i++) {
+                sum += puzzles[w]->emitWord().length();
+                w = (w + 1u == count) ? 0u : w + 1u;
+            }
+            benchSink = sum;
+        }, counters);
+        runOne(name + "/guessWord", [&puzzles, &wordList,
+                                     count](unsigned long ops) {
+            size_t w = 0u;
+            unsigned long sum = 0ul;
+            for (unsigned long i = 0ul; i < ops; i++) {
+                sum += puzzles[w]->guessWord(wordList[w]);
+                w = (w + 1u == count) ? 0u : w + 1u;
+            }
+            benchSink = sum;
+        }, counters);
+    }
+    SequenceEnum::setThreadRandomSource(nullptr);
+}
+
+const std::vector<BenchResult>& BenchRunner::getResults(void) const {
+    return this->results;
+}
+
+void BenchRunner::report(std::ostream& out) const {
+    char row[BENCH_ROW_BYTES];
+    snprintf(row, sizeof(row), "%-24s %9s %9s", "Benchmark", "ns/op",
+             "min ns/op");
+    out << row;
+    bool anyCounters = false;
+    bool anyAllocations = false;
+    for (const BenchResult& result : this->results) {
+        anyCounters = anyCounters || result.haveCounters;
+        anyAllocations = anyAllocations || result.haveAllocations;
+    }
+    if (anyCounters) {
+        snprintf(row, sizeof(row), " %10s %10s %5s %10s %10s", "cycles/op",
+                 "instr/op", "IPC", "cmiss/op", "bmiss/op");
+        out << row;
+    }
+    if (anyAllocations) {
+        snprintf(row, sizeof(row), " %9s %9s", "allocs/op", "bytes/op");
+        out << row;
+    }
+    out << "\n";
+    for (const BenchResult& result : this->results) {
+        snprintf(row, sizeof(row), "%-24s %9.1f %9.1f", result.name.c_str(),
+                 median(result.nsPerOp), *std::min_element(
+                 result.nsPerOp.begin(), result.nsPerOp.end()));
+        out << row;
+        double ops = (double) result.opsPerRep * (double) result.nsPerOp.size();
+        if (result.haveCounters) {
+            const uint64_t * counts = result.counters.counts;
+            double cycles = (double) counts[PERF_CYCLES];
+            snprintf(row, sizeof(row), " %10.1f %10.1f %5.2f %10.3f %10.3f",
+                     cycles / ops, (double) counts[PERF_INSTRUCTIONS] / ops,
+                     cycles > 0.0 ? (double) counts[PERF_INSTRUCTIONS] /
+                     cycles : 0.0, (double) counts[PERF_CACHE_MISSES] / ops,
+                     (double) counts[PERF_BRANCH_MISSES] / ops);
+            out << row;
+        }
+        if (result.haveAllocations) {
+            snprintf(row, sizeof(row), " %9.3f %9.1f",
+                     (double) result.allocations.allocations / ops,
+                     (double) result.allocations.bytes / ops);
+            out << row;
+        }
+        out << "\n";
+    }
+    out.flush();
+}
+
+void BenchRunner::writeJson(std::ostream& out) const {
+    char host[BENCH_HOST_BYTES] = "unknown";
+    gethostname(host, sizeof(host) - 1u);
+    struct utsname system;
+    std::string kernel = "unknown";
+    if (0 == uname(&system)) {
+        kernel = std::string(system.sysname) + " " + system.release + " " +
+                 system.machine;
+    }
+    time_t now = time(nullptr);
+    struct tm utc;
+    char started[BENCH_TIME_BYTES] = "";
+    gmtime_r(&now, &utc);
+    strftime(started, sizeof(started), "%Y-%m-%dT%H:%M:%SZ", &utc);
+    std::string switches;
+#ifdef __OPTIMIZE__
+    switches += " optimized";
+#endif
+#ifdef NDEBUG
+    switches += " NDEBUG";
+#endif
+#ifdef P4_INSTRUMENT
+    switches += " P4_INSTRUMENT";
+#endif
+#ifdef P4_TRACK_ALLOCATIONS
+    switches += " P4_TRACK_ALLOCATIONS";
+#endif
+    out << "{\"environment\": {";
+    out << "\"compiler\": " << quoted(__VERSION__);
+    out << ", \"switches\": " << quoted(switches.empty() ? "" :
+                                        switches.substr(1u));
+    out << ", \"cpu\": " << quoted(cpuModel());
+    out << ", \"hardwareThreads\": " << std::thread::hardware_concurrency();
+    out << ", \"kernel\": " << quoted(kernel);
+    out << ", \"host\": " << quoted(host);
+    out << ", \"started\": " << quoted(started);
+    out << ", \"seed\": " << this->seed;
+    out << ", \"repetitions\": " << this->repetitions;
+    out << ", \"opsPerRep\": " << BENCH_OPS_PER_REP << "},\n";
+    out << " \"benchmarks\": [";
+    for (size_t i = 0u; i < this->results.size(); i++) {
+        const BenchResult& result = this->results[i];
+        out << (0u == i ? "\n" : ",\n") << "  {\"name\": ";
+        out << quoted(result.name) << ", \"nsPerOp\": [";
+        char number[BENCH_TIME_BYTES];
+        for (size_t rep = 0u; rep < result.nsPerOp.size(); rep++) {
+            snprintf(number, sizeof(number), "%.3f", result.nsPerOp[rep]);
+            out << (0u == rep ? "" : ", ") << number;
+        }
+        out << "]";
+        if (result.haveCounters) {
+            out << ", \"counters\": {";
+            for (int counter = 0; counter < NUM_PERF_COUNTERS; counter++) {
+                out << (0 == counter ? "\"" : ", \"");
+                out << PerfCounters::counterName(counter) << "\": ";
+                out << result.counters.counts[counter];
+            }
+            out << "}";
+        }
+        if (result.haveAllocations) {
+            out << ", \"allocations\": " << result.allocations.allocations;
+            out << ", \"allocatedBytes\": " << result.allocations.bytes;
+        }
+        out << "}";
+    }
+    out << "\n]}\n";
+    out.flush();
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+
+//Runs one untimed warm-up repetition, then the timed ones
+void BenchRunner::runOne(const std::string& name, const BenchBody& body,
+                         PerfCounters& counters) {
+    BenchResult result;
+    result.name = name;
+    result.opsPerRep = BENCH_OPS_PER_REP;
+    result.haveCounters = counters.isOpen();
+    for (int i = 0; i < NUM_PERF_COUNTERS; i++) {
+        result.counters.counts[i] = 0u;
+    }
+    result.haveAllocations = AllocationTracker::isEnabled();
+    body(BENCH_OPS_PER_REP);
+    AllocationStats before; //Taken after the warm-up, which doesn't count
+    AllocationStats after;
+    AllocationTracker::snapshot(before);
+    for (int rep = 0; rep < this->repetitions; rep++) {
+        if (result.haveCounters) {
+            counters.start();
+        }
+        std::chrono::steady_clock::time_point start =
+        std::chrono::steady_clock::now();
+        body(BENCH_OPS_PER_REP);
+        std::chrono::duration<double> took =
+        std::chrono::steady_clock::now() - start;
+        PerfSample sample;
+        if (result.haveCounters && counters.stop(sample)) {
+            for (int i = 0; i < NUM_PERF_COUNTERS; i++) {
+                result.counters.counts[i] += sample.counts[i];
+            }
+        }
+        else {
+            result.haveCounters = false;
+        }
+        result.nsPerOp.push_back(took.count() * BENCH_NANOS_PER_SECOND /
+                                 (double) BENCH_OPS_PER_REP);
+    }
+    //Only this thread runs benchmarks, so the difference is all theirs
+    AllocationTracker::snapshot(after);
+    result.allocations.allocations = after.total.allocations -
+                                     before.total.allocations;
+    result.allocations.bytes = after.total.bytes - before.total.bytes;
+    result.allocations.frees = after.total.frees - before.total.frees;
+    result.allocations.freedBytes = after.total.freedBytes -
+                                    before.total.freedBytes;
+    this->results.push_back(result);
+}
@@ -0,0 +1,115 @@
+// Author: Forrest Miller
+// Filename: BenchRunner.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef BenchRunner_h
+#define BenchRunner_h
+
+#include "PerfCounters.h"
+#include "AllocationTracker.h"
+#include "SequenceEnum.h"
+#include "SeqExtract.h"
+#include "SpasEnum.h"
+#include "FastRandom.h"
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+//
+// Class Overview:
+//     This class benchmarks the operations of SequenceEnum, SeqExtract and
+//     SpasEnum over the game's own words: building a puzzle from a word
+//     ("construct"), re-randomizing an existing one ("regenerate"), and the
+//     accessors emitWord() and guessWord(). Each benchmark is run for a
+//     number of timed repetitions of BENCH_OPS_PER_REP operations (after one
+//     untimed warm-up), cycling through the words so every length is covered.
+//     With hardware counters, each repetition is also counted with
+//     PerfCounters and the report gives cycles, instructions, cache misses
+//     and branch misses per operation. With allocation tracking compiled
+//     in, the report also gives the heap allocations and bytes per operation.
+//     The results can also be written as JSON, with every repetition's time
+//     and a description of the machine and build they were measured on, for
+//     BenchComparator to compare against another run.
+//
+// Valid States include: Ready to run (holding one object of each class per
+//                       word), and holding the results of a run.
+//
+// Anticipated Use:  Run from main() with --bench.
+//
+// Class Invariants:  -The objects are only changed by the benchmarks that
+//                     regenerate them.
+//
+// Assumptions:
+//      -Every word is at least 3 letters long.
+//      -Nothing else runs on the calling thread's random source meanwhile.
+//
+// Dependencies: PerfCounters, AllocationTracker, SequenceEnum, SeqExtract,
+//               SpasEnum, PuzzleFactory, FastRandom
+//
+
+const unsigned long BENCH_OPS_PER_REP = 20000ul;
+const int DEFAULT_BENCH_REPS = 10;
+const uint64_t DEFAULT_BENCH_SEED = 20261019u; //Fixed, so runs time the same
+                                               //transforms
+
+struct BenchResult {
+    std::string name;               //"Class/operation"
+    unsigned long opsPerRep;
+    std::vector<double> nsPerOp;    //One per timed repetition
+    bool haveCounters;
+    PerfSample counters;            //Summed over every timed repetition
+    bool haveAllocations;
+    AllocationCounts allocations;   //Summed over every timed repetition
+};
+
+class BenchRunner {
+private:
+    typedef std::function<void(unsigned long operations)> BenchBody;
+
+    std::vector<std::string> words;
+    std::vector<SequenceEnum *> seqEnums;
+    std::vector<SeqExtract *> seqExtracts;
+    std::vector<SpasEnum *> spasEnums;
+    FastRandom rng;
+    uint64_t seed;
+    int repetitions;
+    bool usePerf;
+    std::vector<BenchResult> results;
+
+    void runOne(const std::string& name, const BenchBody& body,
+                PerfCounters& counters);
+
+    BenchRunner(const BenchRunner&);
+    BenchRunner& operator=(const BenchRunner&);
+public:
+    BenchRunner(const std::vector<std::string>& words, int repetitions,
+                bool usePerf, uint64_t seed);
+    //Description: Builds one object of each class for every word
+    //Preconditions: words is not empty; repetitions is positive
+    //Postconditions: Ready to run
+
+    ~BenchRunner(void);
+    //Description: Deletes the objects
+
+    void run(void);
+    //Description: Runs every benchmark, replacing any earlier results
+    //Preconditions: None
+    //Postconditions: getResults() holds one result per benchmark
+
+    const std::vector<BenchResult>& getResults(void) const;
+    //Description: Returns the results of the last run
+
+    void report(std::ostream& out) const;
+    //Description: Prints the median and fastest time per operation of each
+    //             benchmark, and its counters and allocations per operation
+    //             if it has them
+
+    void writeJson(std::ostream& out) const;
+    //Description: Writes the environment (compiler, build switches, CPU,
+    //             kernel, host, time, seed) and every benchmark with each
+    //             repetition's time, as JSON
+};
+
+#endif /* BenchRunner_h */
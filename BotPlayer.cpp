@@ -0,0 +1,189 @@
+// Author: Forrest Miller
+// Filename: BotPlayer.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "BotPlayer.h"
+#include "GameSession.h"
+#include "SequenceEnum.h"
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the BotPlayer
+//          class. The bot tells prompts apart by how the game's output ends,
+//          and clears the output after each answer so it only ever looks at
+//          what the game wrote since its last line.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const char RULES_PROMPT_END[] = "[y/n] ";
+const char LENGTH_PROMPT_END[] = "or 0 to quit]:\n";
+const char GUESS_PROMPT_END[] = "Enter your guess: ";
+const std::string PUZZLE_WORD_LABEL = "Modified word to guess: ";
+const std::string DECLINE_RULES = "n";
+const std::string QUIT_GAME = "0";
+
+template <size_t N>
+static bool endsWith(const OutputBuffer& output, const char (&ending)[N]) {
+    return output.endsWith(ending, N - 1);
+}
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+BotPlayer::BotPlayer(BotStrategy botStrategy, int rounds,
+                     const Dictionary& dict, const AnswerKey& key,
+                     FastRandom& random, std::vector<uint32_t>& latencies)
+: dictionary(dict), answers(key), rng(random), gradeLatencies(latencies) {
+    this->strategy = botStrategy;
+    this->roundsLeft = rounds;
+    this->wordLength = 0;
+    this->newRound = false;
+    this->nextCandidate = 0ul;
+    this->awaitingGrade = false;
+    this->roundsPlayed = 0ul;
+    this->guessesMade = 0ul;
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+unsigned long BotPlayer::getRoundsPlayed(void) const {
+    return this->roundsPlayed;
+}
+
+unsigned long BotPlayer::getGuessesMade(void) const {
+    return this->guessesMade;
+}
+
+bool BotPlayer::parseStrategy(const std::string& name, BotStrategy& out) {
+    if ("oracle" == name) {
+        out = BOT_ORACLE;
+    }
+    else if ("random" == name) {
+        out = BOT_RANDOM;
+    }
+    else if ("solver" == name) {
+        out = BOT_SOLVER;
+    }
+    else if ("mixed" == name) {
+        out = BOT_MIXED;
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+bool BotPlayer::couldBeMadeFrom(const std::string& puzzleWord,
+                                const std::string& original) {
+    if (puzzleWord.length() < original.length()) {
+        //A block was removed, which may have taken the first letter with it
+        return SequenceEnum::isBlockRemovalOf(puzzleWord, original);
+    }
+    if (original.empty() || puzzleWord[0] != original[0]) {
+        return false;
+    }
+    //Letters were added: original must be a subsequence of the puzzle
+    unsigned long matched = 0ul;
+    for (unsigned long i = 0ul; i < puzzleWord.length() &&
+         matched < original.length(); i++) {
+        if (puzzleWord[i] == original[matched]) {
+            matched++;
+        }
+    }
+    return matched == original.length();
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+bool BotPlayer::readMore(void) {
+    std::chrono::steady_clock::time_point now =
+    std::chrono::steady_clock::now();
+    if (this->awaitingGrade) {
+        this->gradeLatencies.push_back((uint32_t)
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                now - this->guessSentAt).count());
+        this->awaitingGrade = false;
+    }
+    OutputBuffer& output = getOutput();
+    if (endsWith(output, GUESS_PROMPT_END)) {
+        std::string text = output.toString();
+        unsigned long label = text.rfind(PUZZLE_WORD_LABEL);
+        unsigned long start = label + PUZZLE_WORD_LABEL.length();
+        std::string puzzleWord = text.substr(start,
+                                             text.find('\n', start) - start);
+        std::string guess = chooseGuess(puzzleWord);
+        output.clear();
+        this->guessesMade++;
+        this->awaitingGrade = true;
+        this->guessSentAt = std::chrono::steady_clock::now();
+        pushLine(guess);
+    }
+    else if (endsWith(output, LENGTH_PROMPT_END)) {
+        output.clear();
+        if (this->roundsLeft <= 0) {
+            pushLine(QUIT_GAME);
+        }
+        else {
+            this->roundsLeft--;
+            this->roundsPlayed++;
+            this->newRound = true;
+            this->wordLength = MIN_PUZZLE_WORD_LENGTH + (int)
+            this->rng.nextBelow((uint32_t) (MAX_PUZZLE_WORD_LENGTH -
+                                            MIN_PUZZLE_WORD_LENGTH + 1));
+            pushLine(std::to_string(this->wordLength));
+        }
+    }
+    else if (endsWith(output, RULES_PROMPT_END)) {
+        output.clear();
+        pushLine(DECLINE_RULES);
+    }
+    else {
+        close(); //Not a prompt this bot knows how to answer
+    }
+    return true;
+}
+
+std::string BotPlayer::chooseGuess(const std::string& puzzleWord) {
+    if (this->newRound) {
+        this->newRound = false;
+        this->candidates.clear();
+        this->nextCandidate = 0ul;
+        if (BOT_ORACLE == this->strategy) {
+            AnswerKey::const_iterator found = this->answers.find(
+                       std::to_string(this->wordLength) + ":" + puzzleWord);
+            if (found != this->answers.end()) {
+                this->candidates.push_back(found->second);
+            }
+        }
+        if (BOT_SOLVER == this->strategy || (BOT_ORACLE == this->strategy &&
+                                             this->candidates.empty())) {
+            findCandidates(puzzleWord); //Oracle falls back to solving
+        }
+    }
+    if (BOT_RANDOM != this->strategy &&
+        this->nextCandidate < this->candidates.size()) {
+        return this->candidates[this->nextCandidate++];
+    }
+    const std::vector<std::string>& words =
+    this->dictionary.getWordsOfLength(this->wordLength);
+    if (words.empty()) {
+        return puzzleWord;
+    }
+    return words[this->rng.nextBelow((uint32_t) words.size())];
+}
+
+void BotPlayer::findCandidates(const std::string& puzzleWord) {
+    for (const std::string& word :
+         this->dictionary.getWordsOfLength(this->wordLength)) {
+        if (couldBeMadeFrom(puzzleWord, word)) {
+            this->candidates.push_back(word);
+        }
+    }
+}
@@ -0,0 +1,106 @@
+// Author: Forrest Miller
+// Filename: BotPlayer.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef BotPlayer_h
+#define BotPlayer_h
+
+#include "GameChannel.h"
+#include "Dictionary.h"
+#include "FastRandom.h"
+#include <chrono>
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//
+// Class Overview:
+//     This class is a simulated player. It is a GameChannel, so a real
+//     GameSession plays against it exactly as it would against a person:
+//     whenever the game asks for input, the bot reads the prompt the game
+//     just wrote and answers it. It declines the rules, asks for random word
+//     lengths for a set number of rounds, then quits. How it guesses depends
+//     on its strategy:
+//        -BOT_ORACLE looks the puzzle up in an answer key built from the
+//         corpus, so it is (nearly) always right on the first guess.
+//        -BOT_RANDOM guesses random dictionary words of the right length, so
+//         it is nearly always wrong and plays every round to MAX_GUESSES.
+//        -BOT_SOLVER guesses, in turn, each dictionary word that the puzzle
+//         could have been made from, like a careful person would.
+//     The time from sending each guess until the game next asks for input
+//     is recorded as that guess's grading latency.
+//
+// Valid States include: Playing, or closed once the bot has quit (or if it
+//                       sees a prompt it doesn't understand).
+//
+// Anticipated Use:  Created by the LoadGenerator, one per simulated player.
+//
+// Class Invariants:  -Only ever holds the one line it is answering with.
+//
+// Assumptions:
+//      -The game's prompts are worded as in GameSession.
+//      -The dictionary and answer key outlive the bot.
+//
+// Dependencies: GameChannel, Dictionary, FastRandom, SequenceEnum
+//
+
+enum BotStrategy {BOT_ORACLE, BOT_RANDOM, BOT_SOLVER, BOT_MIXED};
+
+//Answer key from "<length>:<modified word>" to the original word
+typedef std::unordered_map<std::string, std::string> AnswerKey;
+
+class BotPlayer : public GameChannel {
+private:
+    BotStrategy strategy;
+    int roundsLeft;
+    const Dictionary& dictionary;
+    const AnswerKey& answers;
+    FastRandom& rng;
+    std::vector<uint32_t>& gradeLatencies;
+    int wordLength;
+    bool newRound;
+    std::vector<std::string> candidates;
+    unsigned long nextCandidate;
+    bool awaitingGrade;
+    std::chrono::steady_clock::time_point guessSentAt;
+    unsigned long roundsPlayed;
+    unsigned long guessesMade;
+
+    std::string chooseGuess(const std::string& puzzleWord);
+    void findCandidates(const std::string& puzzleWord);
+protected:
+    bool readMore(void) override;
+    //Description: Answers whatever the game has just asked
+public:
+    BotPlayer(BotStrategy, int rounds, const Dictionary&, const AnswerKey&,
+              FastRandom&, std::vector<uint32_t>& gradeLatencies);
+    //Description: Constructs a bot that will play 'rounds' rounds and append
+    //             the grading latency of each of its guesses (in
+    //             nanoseconds) to gradeLatencies
+    //Preconditions: strategy is not BOT_MIXED
+    //Postconditions: Bot is ready to be handed to GameSession::play()
+
+    unsigned long getRoundsPlayed(void) const;
+    unsigned long getGuessesMade(void) const;
+    //Description: Return how much the bot has played so far
+
+    static bool parseStrategy(const std::string& name, BotStrategy& out);
+    //Description: Reads "oracle", "random", "solver" or "mixed"
+    //Preconditions: None
+    //Postconditions: Returns false if the name is not a strategy
+
+    static bool couldBeMadeFrom(const std::string& puzzleWord,
+                                const std::string& original);
+    //Description: Returns true if some transform in the SequenceEnum family
+    //             could turn 'original' into 'puzzleWord': the same word, a
+    //             longer word keeping the first letter and all of the
+    //             original's letters in order, or a shorter word that is the
+    //             original with one block of letters removed from anywhere,
+    //             the first letter included
+    //Preconditions: Both words are lowercase
+    //Postconditions: None
+};
+
+#endif /* BotPlayer_h */
@@ -0,0 +1,180 @@
+// Author: Forrest Miller
+// Filename: Corpus.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "Corpus.h"
+#include "PuzzleFactory.h"
+#include "AmbiguityJob.h"
+#include "FastRandom.h"
+#include "AllocationTracker.h"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <unordered_map>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the Corpus class.
+//          Buckets are handed out to build threads through an atomic counter,
+//          largest bucket first, and the ambiguity pass reuses AmbiguityJob's
+//          work stealing since its cost is so uneven.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const unsigned int ONE_PUZZLE_ANSWER = 1u;
+const double AMBIGUOUS_PUZZLE_WEIGHT = 0.05; //Relative chance of being shown
+//                                            for puzzles with many answers
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+Corpus::Corpus(const std::string * const words[], const int counts[],
+               int numLengths) {
+    for (unsigned long len = 0ul; len < MAX_DICTIONARY_WORD_LENGTH; len++) {
+        bool haveWords = ((int) len < numLengths && nullptr != words[len]);
+        this->wordArrays[len] = haveWords ? words[len] : nullptr;
+        this->numWords[len] = haveWords ? counts[len] : 0;
+    }
+    this->generation = 0ull;
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+void Corpus::build(const Dictionary& dictionary, uint64_t seed,
+                   unsigned int threads) {
+    AllocationScope scope(ALLOC_CORPUS_BUILD);
+    if (0u == threads) {
+        threads = std::thread::hardware_concurrency();
+    }
+    if (0u == threads) {
+        threads = 1u;
+    }
+    //Order the buckets largest first so the big one doesn't start last
+    std::vector<int> order;
+    for (int len = 0; len < (int) MAX_DICTIONARY_WORD_LENGTH; len++) {
+        if (this->numWords[len] > 0) {
+            order.push_back(len);
+        }
+    }
+    std::sort(order.begin(), order.end(), [this](int a, int b) {
+        return this->numWords[a] > this->numWords[b];
+    });
+    //The SequenceEnum objects are only needed until their ambiguity is
+    //known, then they are snapshotted into Puzzles and thrown away
+    std::vector<SequenceEnum *> built[MAX_DICTIONARY_WORD_LENGTH];
+    std::vector<int> variants[MAX_DICTIONARY_WORD_LENGTH];
+    std::atomic<unsigned long> nextBucket(0ul);
+    auto buildWorker = [&]() {
+        AllocationScope workerScope(ALLOC_CORPUS_BUILD); //Helpers too
+        unsigned long i;
+        while ((i = nextBucket.fetch_add(1ul)) < order.size()) {
+            int len = order[i];
+            buildBucket(len, seed, built[len], variants[len]);
+        }
+    };
+    std::vector<std::thread> helpers;
+    for (unsigned int t = 1u; t < threads && t < order.size(); t++) {
+        helpers.push_back(std::thread(buildWorker));
+    }
+    buildWorker();
+    for (std::thread& t : helpers) {
+        t.join();
+    }
+
+    std::vector<SequenceEnum *> * bucketPtrs[MAX_DICTIONARY_WORD_LENGTH];
+    for (unsigned long len = 0ul; len < MAX_DICTIONARY_WORD_LENGTH; len++) {
+        bucketPtrs[len] = &built[len];
+    }
+    AmbiguityJob ambiguityJob(dictionary, threads);
+    ambiguityJob.run(bucketPtrs, MAX_DICTIONARY_WORD_LENGTH);
+
+    for (int len = 0; len < (int) MAX_DICTIONARY_WORD_LENGTH; len++) {
+        this->buckets[len].reserve(built[len].size());
+        for (unsigned long i = 0ul; i < built[len].size(); i++) {
+            this->buckets[len].push_back(Puzzle(this->wordArrays[len][i],
+                                                *built[len][i],
+                                                variants[len][i], (int) i));
+            delete built[len][i];
+        }
+    }
+
+    std::vector<double> weights;
+    for (int len = 0; len < (int) MAX_DICTIONARY_WORD_LENGTH; len++) {
+        if (this->numWords[len] > 0) {
+            computeSelectionWeights(len, weights);
+            this->samplers[len].build(weights);
+        }
+    }
+}
+
+const Puzzle& Corpus::getPuzzle(int length, int index) const {
+    return this->buckets[length].at(index);
+}
+
+const std::string& Corpus::getWord(int length, int index) const {
+    return this->wordArrays[length][index];
+}
+
+int Corpus::getNumPuzzles(int length) const {
+    if (length < 0 || length >= (int) MAX_DICTIONARY_WORD_LENGTH) {
+        return 0;
+    }
+    return (int) this->buckets[length].size();
+}
+
+const AliasSampler& Corpus::getSampler(int length) const {
+    return this->samplers[length];
+}
+
+uint64_t Corpus::getGeneration(void) const {
+    return this->generation;
+}
+
+void Corpus::setGeneration(uint64_t gen) {
+    this->generation = gen;
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+
+//Each bucket gets its own generator derived from the seed and the length, so
+//the result doesn't depend on which thread builds which bucket
+void Corpus::buildBucket(int length, uint64_t seed,
+                         std::vector<SequenceEnum *>& built,
+                         std::vector<int>& variants) const {
+    uint64_t bucketSeed = seed + (uint64_t) length;
+    FastRandom rng(FastRandom::splitMix(bucketSeed));
+    SequenceEnum::setThreadRandomSource(&rng);
+    built.reserve(this->numWords[length]);
+    variants.reserve(this->numWords[length]);
+    PuzzleFactory::makePuzzles(this->wordArrays[length], this->numWords[length],
+                               built, &variants);
+    SequenceEnum::setThreadRandomSource(nullptr);
+}
+
+//Every distinct word gets a total weight of 1 split evenly between its copies
+//in the word array, and puzzles known to have more than one answer are scaled
+//down so players rarely see them
+void Corpus::computeSelectionWeights(int length,
+                                     std::vector<double>& weights) const {
+    const std::vector<Puzzle>& bucket = this->buckets[length];
+    const std::string * words = this->wordArrays[length];
+    std::unordered_map<std::string, int> copiesOfWord;
+    for (unsigned long i = 0ul; i < bucket.size(); i++) {
+        copiesOfWord[words[i]]++;
+    }
+    weights.assign(bucket.size(), 0.0);
+    for (unsigned long i = 0ul; i < bucket.size(); i++) {
+        weights[i] = 1.0 / (double) copiesOfWord[words[i]];
+        if (bucket[i].getAmbiguityCount() > ONE_PUZZLE_ANSWER) {
+            weights[i] *= AMBIGUOUS_PUZZLE_WEIGHT;
+        }
+    }
+}
@@ -0,0 +1,110 @@
+// Author: Forrest Miller
+// Filename: Corpus.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef Corpus_h
+#define Corpus_h
+
+#include "SequenceEnum.h"
+#include "Puzzle.h"
+#include "AliasSampler.h"
+#include "Dictionary.h"
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+//
+// Class Overview:
+//     This class is one complete set of puzzles for the game: one puzzle per
+//     entry in the driver's word arrays, bucketed by word length, with the
+//     ambiguity of every puzzle computed and an alias table per length for
+//     selecting puzzles. It used to be built piece by piece inside main();
+//     as an object it can be built off to the side (in parallel) and swapped
+//     in whole (see EpochCorpus). Puzzles are built with the SequenceEnum
+//     classes and then kept as immutable Puzzles, so a single built corpus
+//     can be read by every game session at once without locks.
+//
+// Valid States include: Constructed (empty) and built. Only a built corpus
+//                       should be published to readers.
+//
+// Anticipated Use:  Built once at startup and again periodically by the
+//                   EpochCorpus refresher. Once published it is only read.
+//
+// Class Invariants:  -Puzzle i of bucket N was built from wordArrays[N][i], and
+//                     samplers[N] draws indices into that bucket.
+//                    -Nothing in a built corpus changes; per-session display
+//                     state lives in PuzzleView.
+//
+// Assumptions:
+//      -The word arrays outlive the corpus.
+//      -build() is called at most once, before the corpus is shared.
+//
+// Dependencies: SequenceEnum, Puzzle, PuzzleFactory, AmbiguityJob,
+//               AliasSampler, Dictionary, FastRandom
+//
+
+class Corpus {
+private:
+    const std::string * wordArrays[MAX_DICTIONARY_WORD_LENGTH];
+    int numWords[MAX_DICTIONARY_WORD_LENGTH];
+    std::vector<Puzzle> buckets[MAX_DICTIONARY_WORD_LENGTH];
+    AliasSampler samplers[MAX_DICTIONARY_WORD_LENGTH];
+    uint64_t generation;
+
+    void buildBucket(int length, uint64_t seed,
+                     std::vector<SequenceEnum *>& built,
+                     std::vector<int>& variants) const;
+    void computeSelectionWeights(int length, std::vector<double>&) const;
+
+    Corpus(const Corpus&);            //Not copyable, far too big to copy
+    Corpus& operator=(const Corpus&);
+
+    friend class MemoryFootprint; //Reports the memory it takes
+public:
+    Corpus(const std::string * const wordArrays[], const int numWords[],
+           int numLengths);
+    //Description: Constructs an empty corpus over the word arrays. Lengths
+    //             past numLengths, or with null arrays, are left empty.
+    //Preconditions: wordArrays and numWords hold numLengths entries indexed
+    //               by word length
+    //Postconditions: Corpus holds no puzzles until build() is called
+
+    void build(const Dictionary&, uint64_t seed, unsigned int threads = 0u);
+    //Description: Builds every puzzle (one thread per bucket, up to 'threads'
+    //             at once, 0 meaning one per hardware thread), computes each
+    //             puzzle's ambiguity, then builds the alias tables. Every
+    //             bucket gets its own generator seeded from 'seed', so the same
+    //             seed builds the same corpus no matter how threads interleave.
+    //Preconditions: Corpus has not been built before
+    //Postconditions: Corpus is built and ready to be published
+
+    const Puzzle& getPuzzle(int length, int index) const;
+    //Description: Returns puzzle 'index' of the given length. It is safe to
+    //             read from any number of threads.
+    //Preconditions: index must be less than getNumPuzzles(length)
+    //Postconditions: None, this method is const
+
+    const std::string& getWord(int length, int index) const;
+    //Description: Returns the word that puzzle 'index' was built from
+    //Preconditions: index must be less than getNumPuzzles(length)
+    //Postconditions: None, this method is const
+
+    int getNumPuzzles(int length) const;
+    //Description: Returns the number of puzzles of the given length (0 for
+    //             unsupported lengths)
+    //Preconditions: None
+    //Postconditions: None, this method is const
+
+    const AliasSampler& getSampler(int length) const;
+    //Description: Returns the alias table for selecting puzzles of a length
+    //Preconditions: length must be less than MAX_DICTIONARY_WORD_LENGTH
+    //Postconditions: None, this method is const
+
+    uint64_t getGeneration(void) const;
+    void setGeneration(uint64_t);
+    //Description: The generation number tells corpora apart; EpochCorpus
+    //             numbers them as they are published.
+};
+
+#endif /* Corpus_h */
@@ -0,0 +1,86 @@
+// Author: Forrest Miller
+// Filename: Dictionary.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "Dictionary.h"
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the Dictionary class.
+//          Words are kept in one vector per length for fast iteration, with a
+//          hash set alongside for constant-time membership checks.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+//   Implementation Invariants:
+//        Every string in wordsByLength is also in knownWords and vice versa.
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const char DICT_CAP_A = 'A';
+const char DICT_CAP_Z = 'Z';
+const char DICT_CASE_OFFSET = 'a' - 'A';
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+Dictionary::Dictionary(void) {
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+void Dictionary::addWords(const std::string * words, int numWords) {
+    for (int i = 0; i < numWords; i++) {
+        std::string lowerCaseWord = words[i];
+        convertToLower(lowerCaseWord);
+        if (lowerCaseWord.length() >= MAX_DICTIONARY_WORD_LENGTH) {
+            continue; //Too long to be bucketed
+        }
+        //insert().second is false if the word was already present
+        if (this->knownWords.insert(lowerCaseWord).second) {
+            unsigned long length = lowerCaseWord.length();
+            this->wordsByLength[length].push_back(lowerCaseWord);
+        }
+    }
+}
+
+const std::vector<std::string>&
+Dictionary::getWordsOfLength(unsigned long length) const {
+    if (length >= MAX_DICTIONARY_WORD_LENGTH) {
+        static const std::vector<std::string> noWords;
+        return noWords;
+    }
+    return this->wordsByLength[length];
+}
+
+bool Dictionary::containsWord(const std::string& word) const {
+    return containsWord(word.data(), word.length());
+}
+
+bool Dictionary::containsWord(const char * word, size_t length) const {
+    if (length >= MAX_DICTIONARY_WORD_LENGTH) {
+        return false;
+    }
+    std::string lowerCaseWord(word, length); //Short enough to stay inline
+    convertToLower(lowerCaseWord);
+    return (this->knownWords.find(lowerCaseWord) != this->knownWords.end());
+}
+
+unsigned long Dictionary::getTotalWordCount(void) const {
+    return (unsigned long) this->knownWords.size();
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+void Dictionary::convertToLower(std::string& strOfLetters) const {
+    for (unsigned long i = 0ul; i < strOfLetters.length(); i++) {
+        if (strOfLetters[i] >= DICT_CAP_A && strOfLetters[i] <= DICT_CAP_Z) {
+            strOfLetters[i] += DICT_CASE_OFFSET;
+        }
+    }
+}
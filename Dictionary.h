@@ -0,0 +1,82 @@
+// Author: Forrest Miller
+// Filename: Dictionary.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef Dictionary_h
+#define Dictionary_h
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+//
+// Class Overview:
+//     This class holds the collection of English words that the guessing game
+//     draws from, sorted into buckets by word length. Words are stored once
+//     each (the driver's static word arrays contain a handful of duplicates,
+//     these are dropped when words are added). The dictionary supports
+//     retrieving every distinct word of a given length and checking whether a
+//     string is a known word.
+//
+// Valid States include: The object is always in a valid state. A freshly
+//                       constructed dictionary is empty.
+//
+// Anticipated Use:  Built once during initialization from the driver's word
+//                   arrays and then only read from, so it can be shared by any
+//                   number of threads once construction is complete.
+//
+// Class Invariants:  -Every stored word is lowercase and appears exactly once.
+//                    -A word is only ever stored in the bucket matching its
+//                     length.
+//
+// Assumptions:
+//      -Words consist only of letters. Words that are longer than
+//       MAX_DICTIONARY_WORD_LENGTH - 1 characters are ignored.
+//
+// Dependencies: None
+//
+
+const unsigned long MAX_DICTIONARY_WORD_LENGTH = 13ul;
+
+class Dictionary {
+private:
+    std::vector<std::string> wordsByLength[MAX_DICTIONARY_WORD_LENGTH];
+    std::unordered_set<std::string> knownWords;
+
+    void convertToLower(std::string& strOfLetters) const;
+
+    friend class MemoryFootprint; //Reports the memory it takes
+public:
+    Dictionary(void);
+    //Description: Constructs an empty dictionary
+    //Preconditions: None
+    //Postconditions: Dictionary contains no words
+
+    void addWords(const std::string * words, int numWords);
+    //Description: Adds each word in the array to the bucket matching its
+    //             length. Words already in the dictionary are skipped.
+    //Preconditions: words must point to at least numWords strings
+    //Postconditions: Every word of a supported length is in the dictionary
+
+    const std::vector<std::string>& getWordsOfLength(unsigned long) const;
+    //Description: Returns every distinct word of the requested length, in the
+    //             order they were first added.
+    //Preconditions: None, unsupported lengths return an empty bucket
+    //Postconditions: None, this method is const
+
+    bool containsWord(const std::string&) const;
+    bool containsWord(const char * word, size_t length) const;
+    //Description: Returns true if the word (compared case-insensitively) is
+    //             in the dictionary. Words too long to be stored are turned
+    //             away before any copy is made.
+    //Preconditions: None
+    //Postconditions: None, this method is const
+
+    unsigned long getTotalWordCount(void) const;
+    //Description: Returns the number of distinct words across all lengths
+    //Preconditions: None
+    //Postconditions: None, this method is const
+};
+
+#endif /* Dictionary_h */
@@ -0,0 +1,294 @@
+// Author: Forrest Miller
+// Filename: DistributionProfiler.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "DistributionProfiler.h"
+#include "PuzzleFactory.h"
+#include "SequenceEnum.h"
+#include "FastRandom.h"
+#include <algorithm>
+#include <chrono>
+#include <iterator>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the
+//          DistributionProfiler class. Each worker takes an equal share of
+//          every word length's samples, so the threads finish together
+//          however the lengths differ in cost.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const int MIN_SAMPLED_WORD_LENGTH = 3;
+const int DISTRIBUTION_CELL_BYTES = 32;
+const int DISTRIBUTION_CELL_WIDTH = 8;  //Wider where a column's name is
+const double SAMPLES_PER_MILLION = 1e6;
+const char * const BAND_COLUMNS[] = {"1 char", "2 chars", "3 chars",
+    "4 chars", "5 chars", "whole"};
+const char * const BRANCH_COLUMNS[] = {"first", "last end", "last in",
+    "3-letter", "mid end", "mid repl", "mid in", "whole"};
+const char * const SPAS_COLUMNS[] = {"concat", "truncate"};
+
+//One row of counts per word length (empty for lengths that weren't sampled)
+typedef std::vector<std::vector<uint64_t> > CountRows;
+
+//Prints each row's counts as percentages of the row. Named columns are all
+//shown, even empty ones; index columns stop after the last one with counts.
+static void printTable(std::ostream& out, const std::string& title,
+                       const std::vector<std::string>& columns,
+                       const CountRows& rows, bool byIndex) {
+    size_t used = byIndex ? 0u : columns.size();
+    for (const std::vector<uint64_t>& row : rows) {
+        for (size_t col = 0u; byIndex && col < row.size(); col++) {
+            if (row[col] > 0u) {
+                used = std::max(used, col + 1u);
+            }
+        }
+    }
+    out << "\n" << title << " (% of each length's row)\nLength";
+    char cell[DISTRIBUTION_CELL_BYTES];
+    std::vector<int> widths(used, DISTRIBUTION_CELL_WIDTH);
+    for (size_t col = 0u; col < used; col++) {
+        widths[col] = std::max(widths[col], (int) columns[col].length());
+        snprintf(cell, sizeof(cell), " %*s", widths[col],
+                 columns[col].c_str());
+        out << cell;
+    }
+    out << "\n";
+    for (size_t len = 0u; len < rows.size(); len++) {
+        const std::vector<uint64_t>& row = rows[len];
+        uint64_t total = 0u;
+        for (uint64_t count : row) {
+            total += count;
+        }
+        if (0u == total) {
+            continue;
+        }
+        snprintf(cell, sizeof(cell), "%6zu", len);
+        out << cell;
+        for (size_t col = 0u; col < used; col++) {
+            snprintf(cell, sizeof(cell), " %*.3f", widths[col],
+                     100.0 * (double) row[col] / (double) total);
+            out << cell;
+        }
+        out << "\n";
+    }
+}
+
+static std::vector<std::string> namedColumns(const char * const * names,
+                                             size_t count) {
+    return std::vector<std::string>(names, names + count);
+}
+
+static std::vector<std::string> indexColumns(void) {
+    std::vector<std::string> columns;
+    for (int i = 0; i < TALLY_SLOTS; i++) {
+        columns.push_back(std::to_string(i));
+    }
+    return columns;
+}
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+DistributionProfiler::DistributionProfiler(const std::string * const words[],
+                                           const int * counts, int lengths,
+                                           uint64_t randomSeed) {
+    this->wordArrays = words;
+    this->numWords = counts;
+    this->numLengths = std::min(lengths, MAX_TALLY_WORD_LENGTH);
+    this->seed = randomSeed;
+    this->samplesPerLength = 0u;
+    this->threadsUsed = 0u;
+    this->seconds = 0.0;
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+void DistributionProfiler::run(uint64_t samples, unsigned int threads) {
+    if (0u == threads) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    this->samplesPerLength = samples;
+    this->threadsUsed = threads;
+    std::vector<TransformTally> tallies(threads);
+    auto started = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned int i = 1u; i < threads; i++) {
+        workers.emplace_back([this, i, &tallies]() {
+            work(i, tallies[i]);
+        });
+    }
+    work(0u, tallies[0]);
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    std::chrono::duration<double> elapsed =
+    std::chrono::steady_clock::now() - started;
+    this->seconds = elapsed.count();
+    this->total = TransformTally();
+    for (const TransformTally& tally : tallies) {
+        this->total.add(tally);
+    }
+}
+
+const TransformTally& DistributionProfiler::getTally(void) const {
+    return this->total;
+}
+
+void DistributionProfiler::report(std::ostream& out) const {
+    uint64_t transforms = 0u;
+    for (int len = 0; len < this->numLengths; len++) {
+        if (canSample(len)) {
+            transforms += this->samplesPerLength;
+        }
+    }
+    char line[DISTRIBUTION_CELL_BYTES * 4];
+    snprintf(line, sizeof(line), "Sampled %llu transforms (%llu per word "
+             "length) on %u threads in %.2f s, %.2f million per second\n",
+             (unsigned long long) transforms,
+             (unsigned long long) this->samplesPerLength, this->threadsUsed,
+             this->seconds, (this->seconds > 0.0) ?
+             (double) transforms / this->seconds / SAMPLES_PER_MILLION : 0.0);
+    out << line;
+    CountRows variants(this->numLengths);
+    CountRows bands(this->numLengths);
+    CountRows inserted(this->numLengths);
+    CountRows branches(this->numLengths);
+    CountRows positions(this->numLengths);
+    CountRows spasChoices(this->numLengths);
+    CountRows spasStarts(this->numLengths);
+    CountRows spasLengths(this->numLengths);
+    CountRows extractStarts(this->numLengths);
+    CountRows extractLengths(this->numLengths);
+    CountRows outputs[TALLY_VARIANTS];
+    uint64_t discardedSeqEnums = 0u;
+    for (int variant = 0; variant < TALLY_VARIANTS; variant++) {
+        outputs[variant].resize(this->numLengths);
+    }
+    for (int len = 0; len < this->numLengths; len++) {
+        if (!canSample(len)) {
+            continue;
+        }
+        const LengthTally& tally = this->total.getLength(len);
+        const uint64_t * seqEnum = tally.outcomes[DO_SEQ_ENUM];
+        variants[len].assign(tally.variants, tally.variants + TALLY_VARIANTS);
+        bands[len].assign(seqEnum + TALLY_BAND_ONE,
+                          seqEnum + TALLY_BAND_WHOLE_WORD + 1);
+        branches[len].assign(seqEnum + TALLY_ADD_FIRST_DOUBLED,
+                             seqEnum + TALLY_ADD_FROM_WHOLE_WORD + 1);
+        spasChoices[len].assign(
+            tally.outcomes[DO_SPAS_ENUM] + TALLY_SPAS_CONCATENATED,
+            tally.outcomes[DO_SPAS_ENUM] + TALLY_SPAS_TRUNCATED + 1);
+        positions[len].assign(tally.insertPositions[DO_SEQ_ENUM],
+                              tally.insertPositions[DO_SEQ_ENUM] +
+                              TALLY_SLOTS);
+        spasStarts[len].assign(tally.spasStarts, tally.spasStarts +
+                               TALLY_SLOTS);
+        spasLengths[len].assign(tally.spasLengths, tally.spasLengths +
+                                TALLY_SLOTS);
+        extractStarts[len].assign(tally.extractStarts, tally.extractStarts +
+                                  TALLY_SLOTS);
+        extractLengths[len].assign(tally.extractLengths,
+                                   tally.extractLengths + TALLY_SLOTS);
+        for (int variant = 0; variant < TALLY_VARIANTS; variant++) {
+            outputs[variant][len].assign(tally.outputLengths[variant],
+                                         tally.outputLengths[variant] +
+                                         TALLY_SLOTS);
+        }
+        //A SequenceEnum only ever grows, so its growth is what it inserted
+        inserted[len].assign(TALLY_SLOTS, 0u);
+        for (int outLen = len; outLen < TALLY_SLOTS; outLen++) {
+            inserted[len][outLen - len] =
+            tally.outputLengths[DO_SEQ_ENUM][outLen];
+        }
+        for (int band = TALLY_BAND_ONE; band <= TALLY_BAND_WHOLE_WORD;
+             band++) {
+            discardedSeqEnums += tally.outcomes[DO_SEQ_EXTRACT][band] +
+                                 tally.outcomes[DO_SPAS_ENUM][band];
+        }
+    }
+    const char * const variantNames[] = {
+        PuzzleFactory::variantName(DO_SEQ_ENUM),
+        PuzzleFactory::variantName(DO_SEQ_EXTRACT),
+        PuzzleFactory::variantName(DO_SPAS_ENUM)};
+    printTable(out, "Variant chosen", namedColumns(variantNames,
+               std::size(variantNames)), variants, false);
+    printTable(out, "SequenceEnum: computeSeqEnum() band",
+               namedColumns(BAND_COLUMNS, std::size(BAND_COLUMNS)), bands,
+               false);
+    printTable(out, "SequenceEnum: characters inserted", indexColumns(),
+               inserted, true);
+    printTable(out, "SequenceEnum: addCharacters() branch per character",
+               namedColumns(BRANCH_COLUMNS, std::size(BRANCH_COLUMNS)),
+               branches, false);
+    printTable(out, "SequenceEnum: index each character was placed at",
+               indexColumns(), positions, true);
+    printTable(out, "SpasEnum: computeSpasEnum() choice",
+               namedColumns(SPAS_COLUMNS, std::size(SPAS_COLUMNS)),
+               spasChoices, false);
+    printTable(out, "SpasEnum: substring start", indexColumns(), spasStarts,
+               true);
+    printTable(out, "SpasEnum: substring length", indexColumns(),
+               spasLengths, true);
+    printTable(out, "SeqExtract: removed substring start", indexColumns(),
+               extractStarts, true);
+    printTable(out, "SeqExtract: removed substring length", indexColumns(),
+               extractLengths, true);
+    for (int variant = 0; variant < TALLY_VARIANTS; variant++) {
+        printTable(out, std::string(PuzzleFactory::variantName(variant)) +
+                   ": output length", indexColumns(), outputs[variant], true);
+    }
+    out << "\ncomputeSeqEnum() also ran, and its result was thrown away, "
+    "while constructing\n" << discardedSeqEnums << " SeqExtract and "
+    "SpasEnum puzzles (their base class constructor)\n";
+    out.flush();
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+bool DistributionProfiler::canSample(int length) const {
+    return length >= MIN_SAMPLED_WORD_LENGTH && length < this->numLengths &&
+           nullptr != this->wordArrays[length] && this->numWords[length] > 0;
+}
+
+//Builds this worker's share of every length's samples. Only the first
+//(samples % threads) workers take one more.
+void DistributionProfiler::work(unsigned int index,
+                                TransformTally& tally) const {
+    uint64_t workerSeed = this->seed + (uint64_t) index;
+    FastRandom rng(FastRandom::splitMix(workerSeed));
+    SequenceEnum::setThreadRandomSource(&rng);
+    SequenceEnum::setThreadTally(&tally);
+    uint64_t share = this->samplesPerLength / this->threadsUsed;
+    if (index < this->samplesPerLength % this->threadsUsed) {
+        share++;
+    }
+    for (int len = 0; len < this->numLengths; len++) {
+        if (!canSample(len)) {
+            continue;
+        }
+        const std::string * words = this->wordArrays[len];
+        uint32_t count = (uint32_t) this->numWords[len];
+        for (uint64_t i = 0u; i < share; i++) {
+            const std::string& word = words[rng.nextBelow(count)];
+            int variant = PuzzleFactory::randomVariant();
+            tally.beginTransform(len, variant);
+            tally.countOutputLength(len, PuzzleFactory::encryptWord(word,
+                                    variant).length());
+        }
+    }
+    SequenceEnum::setThreadTally(nullptr);
+    SequenceEnum::setThreadRandomSource(nullptr);
+}
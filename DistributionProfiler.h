@@ -0,0 +1,86 @@
+// Author: Forrest Miller
+// Filename: DistributionProfiler.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef DistributionProfiler_h
+#define DistributionProfiler_h
+
+#include "TransformTally.h"
+#include <ostream>
+#include <stdint.h>
+#include <string>
+
+//
+// Class Overview:
+//     This class measures what the transforms actually produce by running
+//     them many times (a Monte Carlo estimate) and counting every random
+//     choice they make. For every word length it builds the given number of
+//     puzzles the way the corpus does: a random word of the length, a
+//     variant from PuzzleFactory::randomVariant(), and the real transform
+//     code, run on the stack (as PuzzleFactory::encryptWord() does) with a
+//     TransformTally counting. The work is split evenly over the threads,
+//     each with its own generator and tally, which are added up at the end.
+//     The report has one table per distribution, with a row per word length
+//     and each column's share of the row:
+//        -which variant was chosen
+//        -computeSeqEnum()'s CHANCE_ bands, the characters it inserted,
+//         which addCharacters() branch placed each one and where
+//        -computeSpasEnum()'s truncate or concatenate choice, and its
+//         substring's start and length
+//        -where SeqExtract's removed substring started and its length
+//        -the output length of each variant
+//     A branch that never runs shows as a column of zeros.
+//
+// Valid States include: Not yet run, or run (holding the added up tally).
+//
+// Anticipated Use:  main() runs one with --distribution, on its own or after
+//                   the benchmarks.
+//
+// Class Invariants:  -The tally holds exactly the samples of the last run.
+//
+// Assumptions:
+//      -The word arrays outlive the profiler.
+//      -Each thread's transforms draw from its own generator, so nothing is
+//       shared while sampling.
+//
+// Dependencies: TransformTally, PuzzleFactory, SequenceEnum, FastRandom
+//
+
+const uint64_t DEFAULT_DISTRIBUTION_SAMPLES = 1000000ull; //Per word length
+
+class DistributionProfiler {
+private:
+    const std::string * const * wordArrays;
+    const int * numWords;
+    int numLengths;
+    uint64_t seed;
+    TransformTally total;
+    uint64_t samplesPerLength;
+    unsigned int threadsUsed;
+    double seconds;
+
+    bool canSample(int length) const;
+    void work(unsigned int index, TransformTally& tally) const;
+
+    DistributionProfiler(const DistributionProfiler&);
+    DistributionProfiler& operator=(const DistributionProfiler&);
+public:
+    DistributionProfiler(const std::string * const wordArrays[],
+                         const int * numWords, int numLengths, uint64_t seed);
+    //Description: Constructs a profiler over the words of each length
+    //Preconditions: numWords[len] is the length of wordArrays[len]
+
+    void run(uint64_t samplesPerLength, unsigned int threads);
+    //Description: Builds samplesPerLength puzzles for every word length
+    //             that has words, on the given number of threads (0 for one
+    //             per hardware thread), replacing any earlier run
+
+    const TransformTally& getTally(void) const;
+    //Description: Returns the counts from the last run
+
+    void report(std::ostream& out) const;
+    //Description: Prints how fast the run went, then every distribution
+};
+
+#endif /* DistributionProfiler_h */
@@ -0,0 +1,206 @@
+// Author: Forrest Miller
+// Filename: EpochCorpus.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "EpochCorpus.h"
+#include "FastRandom.h"
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the EpochCorpus
+//          class. All of the reader-side atomics use sequentially consistent
+//          ordering. That is what guarantees the publisher either sees a
+//          reader's slot, or the reader sees the new pointer.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+//   Implementation Invariants:
+//        A reader sets its slot to the epoch *before* loading the corpus
+//          pointer. If the publisher's scan misses that store, the store (and
+//          so the pointer load after it) happened after the swap, and the
+//          reader got the new corpus.
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const uint64_t IDLE_EPOCH = UINT64_MAX;
+const uint64_t FIRST_GENERATION = 1ull;
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+EpochCorpus::EpochCorpus(Corpus * initial) {
+    initial->setGeneration(FIRST_GENERATION);
+    this->current.store(initial);
+    this->globalEpoch.store(FIRST_GENERATION);
+    for (ReaderSlot& slot : this->slots) {
+        slot.epoch.store(IDLE_EPOCH);
+        slot.claimed.store(false);
+    }
+    this->wordArrays = nullptr;
+    this->numWords = nullptr;
+    this->numLengths = 0;
+    this->dictionary = nullptr;
+    this->refreshSeed = 0ull;
+    this->refreshInterval = std::chrono::milliseconds(0);
+    this->stopRequested = false;
+}
+
+EpochCorpus::EpochCorpus(void) {
+    this->current.store(nullptr);
+    this->globalEpoch.store(FIRST_GENERATION - 1ull);
+    for (ReaderSlot& slot : this->slots) {
+        slot.epoch.store(IDLE_EPOCH);
+        slot.claimed.store(false);
+    }
+    this->wordArrays = nullptr;
+    this->numWords = nullptr;
+    this->numLengths = 0;
+    this->dictionary = nullptr;
+    this->refreshSeed = 0ull;
+    this->refreshInterval = std::chrono::milliseconds(0);
+    this->stopRequested = false;
+}
+
+EpochCorpus::~EpochCorpus(void) {
+    stopRefreshing();
+    for (RetiredCorpus& r : this->retired) {
+        delete r.corpus;
+    }
+    delete this->current.load();
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+int EpochCorpus::registerReader(void) {
+    for (int i = 0; i < MAX_CORPUS_READERS; i++) {
+        bool unclaimed = false;
+        if (this->slots[i].claimed.compare_exchange_strong(unclaimed, true)) {
+            return i;
+        }
+    }
+    return NO_READER_SLOT;
+}
+
+void EpochCorpus::unregisterReader(int slot) {
+    this->slots[slot].epoch.store(IDLE_EPOCH);
+    this->slots[slot].claimed.store(false);
+}
+
+const Corpus * EpochCorpus::enter(int slot) {
+    this->slots[slot].epoch.store(this->globalEpoch.load());
+    return this->current.load();
+}
+
+void EpochCorpus::exit(int slot) {
+    this->slots[slot].epoch.store(IDLE_EPOCH);
+}
+
+void EpochCorpus::waitForCorpus(void) {
+    if (nullptr != this->current.load()) {
+        return;
+    }
+    std::unique_lock<std::mutex> lock(this->publishedLock);
+    this->publishedWake.wait(lock, [this] {
+        return nullptr != this->current.load();
+    });
+}
+
+void EpochCorpus::publish(Corpus * fresh) {
+    //The epoch counts publications, so it doubles as the generation number
+    fresh->setGeneration(this->globalEpoch.load() + 1ull);
+    Corpus * old;
+    {
+        //Held so a reader can't check for a corpus, miss this one, and then
+        //sleep through the wake-up
+        std::lock_guard<std::mutex> lock(this->publishedLock);
+        old = this->current.exchange(fresh);
+    }
+    //Readers who entered at or before this epoch may still hold 'old'
+    uint64_t oldEpoch = this->globalEpoch.fetch_add(1ull);
+    if (nullptr == old) { //The first corpus of an exchange constructed empty
+        this->publishedWake.notify_all();
+        return;
+    }
+    RetiredCorpus r = { old, oldEpoch };
+    this->retired.push_back(r);
+    reclaim();
+}
+
+void EpochCorpus::reclaim(void) {
+    uint64_t oldestActive = IDLE_EPOCH;
+    for (ReaderSlot& slot : this->slots) {
+        uint64_t e = slot.epoch.load();
+        if (e < oldestActive) {
+            oldestActive = e;
+        }
+    }
+    std::vector<RetiredCorpus> stillVisible;
+    for (RetiredCorpus& r : this->retired) {
+        if (r.retiredAtEpoch < oldestActive) {
+            delete r.corpus;
+        }
+        else {
+            stillVisible.push_back(r);
+        }
+    }
+    this->retired.swap(stillVisible);
+}
+
+void EpochCorpus::startRefreshing(const std::string * const words[],
+                                  const int counts[], int lengths,
+                                  const Dictionary& dict, uint64_t seed,
+                                  std::chrono::milliseconds interval) {
+    if (this->refresher.joinable()) {
+        return; //Already refreshing
+    }
+    this->wordArrays = words;
+    this->numWords = counts;
+    this->numLengths = lengths;
+    this->dictionary = &dict;
+    this->refreshSeed = seed;
+    this->refreshInterval = interval;
+    this->stopRequested = false;
+    this->refresher = std::thread(&EpochCorpus::refreshLoop, this);
+}
+
+void EpochCorpus::stopRefreshing(void) {
+    {
+        std::lock_guard<std::mutex> guard(this->refresherLock);
+        this->stopRequested = true;
+    }
+    this->refresherWake.notify_all();
+    if (this->refresher.joinable()) {
+        this->refresher.join();
+    }
+}
+
+uint64_t EpochCorpus::getGeneration(void) const {
+    return this->globalEpoch.load(); //Safe to read from any thread
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+void EpochCorpus::refreshLoop(void) {
+    std::unique_lock<std::mutex> lock(this->refresherLock);
+    while (!this->stopRequested) {
+        auto stopping = [this] { return this->stopRequested; };
+        if (this->refresherWake.wait_for(lock, this->refreshInterval,
+                                         stopping)) {
+            break;
+        }
+        lock.unlock(); //Build without holding the lock so stop() isn't held up
+        Corpus * fresh = new Corpus(this->wordArrays, this->numWords,
+                                    this->numLengths);
+        fresh->build(*this->dictionary,
+                     FastRandom::splitMix(this->refreshSeed));
+        publish(fresh);
+        lock.lock();
+    }
+    lock.unlock();
+    reclaim(); //Catch anything readers were still holding at the last publish
+}
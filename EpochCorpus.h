@@ -0,0 +1,192 @@
+// Author: Forrest Miller
+// Filename: EpochCorpus.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef EpochCorpus_h
+#define EpochCorpus_h
+
+#include "Corpus.h"
+#include "Dictionary.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+//
+// Class Overview:
+//     This class publishes the corpus that the game reads from and replaces it
+//     periodically with a freshly randomized one, without ever making a reader
+//     wait or letting a reader see a half-built corpus. New corpora are built
+//     completely off to the side (in parallel, see Corpus::build) and then
+//     published with a single atomic pointer swap.
+//
+//     Old corpora are reclaimed with epochs. Every reader thread owns a slot.
+//     Before it touches the corpus it writes the current epoch into its slot,
+//     and when it is done it marks the slot idle. Publishing bumps the epoch,
+//     and an old corpus is only deleted once every slot is idle or shows a
+//     later epoch, so no reader can still be holding it. Readers only ever do
+//     plain atomic loads and stores.
+//
+//     A process that wants its first prompt up before the first corpus is
+//     built can construct the exchange empty and publish the first corpus
+//     from the background. Readers that need a corpus call waitForCorpus()
+//     first, which only blocks until that first publish.
+//
+// Valid States include: Empty (constructed without a corpus, until the first
+//                       publish), or holding exactly one published corpus.
+//                       The refresher thread may be running or stopped.
+//
+// Anticipated Use:  One per process. Each thread that reads the corpus calls
+//                   registerReader() once, then wraps each use of the corpus
+//                   in enter()/exit() (or a ReadGuard).
+//
+// Class Invariants:  -A corpus returned by enter() stays alive until the same
+//                     slot calls exit().
+//                    -Only the thread calling publish() (normally the
+//                     refresher) deletes retired corpora.
+//
+// Assumptions:
+//      -At most MAX_CORPUS_READERS threads read at once.
+//      -A slot is used by one thread at a time and enter()/exit() calls on a
+//       slot are not nested.
+//      -publish() is only called from one thread at a time.
+//
+// Dependencies: Corpus, Dictionary
+//
+
+const int MAX_CORPUS_READERS = 64;
+const int NO_READER_SLOT = -1;
+
+class EpochCorpus {
+private:
+    struct ReaderSlot {
+        std::atomic<uint64_t> epoch; //IDLE_EPOCH when not reading
+        std::atomic<bool> claimed;
+        char padding[64 - sizeof(std::atomic<uint64_t>) -
+                     sizeof(std::atomic<bool>)];
+    };
+    struct RetiredCorpus {
+        Corpus * corpus;
+        uint64_t retiredAtEpoch; //Safe once no reader is at or before this
+    };
+
+    std::atomic<Corpus *> current;
+    std::atomic<uint64_t> globalEpoch;
+    ReaderSlot slots[MAX_CORPUS_READERS];
+    std::vector<RetiredCorpus> retired;
+
+    //Refresher state
+    const std::string * const * wordArrays;
+    const int * numWords;
+    int numLengths;
+    const Dictionary * dictionary;
+    uint64_t refreshSeed;
+    std::chrono::milliseconds refreshInterval;
+    std::thread refresher;
+    std::mutex refresherLock; //Only used to put the refresher to sleep
+    std::condition_variable refresherWake;
+    bool stopRequested;
+
+    //First publish, for an exchange constructed empty
+    std::mutex publishedLock;
+    std::condition_variable publishedWake;
+
+    void refreshLoop(void);
+    EpochCorpus(const EpochCorpus&);
+    EpochCorpus& operator=(const EpochCorpus&);
+public:
+    EpochCorpus(Corpus * initial);
+    //Description: Constructs the exchange with an already built corpus,
+    //             which becomes generation 1
+    //Preconditions: initial must have been built and allocated with new
+    //Postconditions: The exchange owns the corpus
+
+    EpochCorpus(void);
+    //Description: Constructs the exchange with no corpus. enter() returns
+    //             null until the first publish(), which is generation 1.
+    //Preconditions: None
+    //Postconditions: Readers must waitForCorpus() before entering
+
+    ~EpochCorpus(void);
+    //Description: Stops the refresher and deletes every corpus
+    //Preconditions: No reader is between enter() and exit()
+
+    int registerReader(void);
+    //Description: Claims a reader slot for the calling thread
+    //Preconditions: None
+    //Postconditions: Returns the slot, or NO_READER_SLOT if all are taken
+
+    void unregisterReader(int slot);
+    //Description: Releases a slot claimed with registerReader()
+    //Preconditions: The slot is not between enter() and exit()
+    //Postconditions: The slot can be claimed again
+
+    const Corpus * enter(int slot);
+    //Description: Pins and returns the currently published corpus. Never
+    //             blocks.
+    //Preconditions: slot was returned by registerReader()
+    //Postconditions: The corpus stays alive until exit(slot)
+
+    void exit(int slot);
+    //Description: Unpins whatever corpus the slot entered
+    //Preconditions: enter(slot) was called
+    //Postconditions: The corpus may be reclaimed
+
+    void waitForCorpus(void);
+    //Description: Blocks until a corpus has been published. Returns at once
+    //             (after one atomic load) once one has.
+    //Preconditions: Something will publish a corpus
+    //Postconditions: enter() returns a corpus from now on
+
+    void publish(Corpus * fresh);
+    //Description: Swaps in a new corpus with one atomic store and retires the
+    //             old one (if there was one), then deletes any retired corpus
+    //             no reader can see
+    //Preconditions: fresh must be built and allocated with new
+    //Postconditions: New enter() calls see the fresh corpus
+
+    void reclaim(void);
+    //Description: Deletes retired corpora that no reader can still see
+    //Preconditions: Called from the publishing thread
+    //Postconditions: None
+
+    void startRefreshing(const std::string * const wordArrays[],
+                         const int numWords[], int numLengths,
+                         const Dictionary&, uint64_t seed,
+                         std::chrono::milliseconds interval);
+    //Description: Starts a background thread that builds and publishes a new
+    //             corpus every interval
+    //Preconditions: The word arrays and dictionary outlive the refresher
+    //Postconditions: Corpus is re-randomized periodically
+
+    void stopRefreshing(void);
+    //Description: Stops the refresher thread, waking it if it is asleep
+    //Preconditions: None
+    //Postconditions: No more corpora will be published by the refresher
+
+    uint64_t getGeneration(void) const;
+    //Description: Returns the generation number of the published corpus
+    //Preconditions: None
+    //Postconditions: None, this method is const
+
+    class ReadGuard {
+    private:
+        EpochCorpus& exchange;
+        int slot;
+        const Corpus * corpus;
+    public:
+        ReadGuard(EpochCorpus& ex, int readerSlot)
+        : exchange(ex), slot(readerSlot), corpus(ex.enter(readerSlot)) {}
+        ~ReadGuard(void) { this->exchange.exit(this->slot); }
+        const Corpus * operator->(void) const { return this->corpus; }
+        const Corpus& operator*(void) const { return *this->corpus; }
+    };
+    //Description: Scoped enter()/exit() for one reader slot
+};
+
+#endif /* EpochCorpus_h */
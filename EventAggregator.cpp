@@ -0,0 +1,196 @@
+// Author: Forrest Miller
+// Filename: EventAggregator.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "EventAggregator.h"
+#include <algorithm>
+#include <atomic>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <iostream>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <vector>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the EventAggregator
+//          class. A record with a length or transform out of range is counted
+//          as bad and left out of every row, so a damaged segment can't write
+//          outside the tables.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const double PERCENT = 100.0;
+const double MICROSECONDS_PER_SECOND = 1000000.0;
+const int LABEL_BYTES = 32;
+const int ROW_BYTES = 128;
+
+static void clearTotals(RoundTotals& totals) {
+    memset(&totals, 0, sizeof(totals));
+}
+
+static bool endsWith(const std::string& text, const char * suffix) {
+    size_t length = strlen(suffix);
+    return text.length() >= length &&
+           0 == text.compare(text.length() - length, length, suffix);
+}
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+EventAggregator::EventAggregator(void) {
+    for (unsigned long len = 0ul; len < MAX_DICTIONARY_WORD_LENGTH; len++) {
+        clearTotals(this->byLength[len]);
+    }
+    for (int variant = 0; variant < SEQ_ENUM_VARIANTS; variant++) {
+        clearTotals(this->byTransform[variant]);
+    }
+    this->segments = 0u;
+    this->records = 0u;
+    this->badRecords = 0u;
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+bool EventAggregator::scanDirectory(const std::string& directory) {
+    DIR * dir = opendir(directory.c_str());
+    if (nullptr == dir) {
+        std::cerr << "Could not read " << directory << ": " << strerror(errno)
+        << std::endl;
+        return false;
+    }
+    std::vector<std::string> names;
+    while (struct dirent * entry = readdir(dir)) {
+        std::string name = entry->d_name;
+        if (0 == name.compare(0, strlen(EVENT_LOG_FILE_PREFIX),
+                              EVENT_LOG_FILE_PREFIX) &&
+            endsWith(name, EVENT_LOG_FILE_SUFFIX)) {
+            names.push_back(name);
+        }
+    }
+    closedir(dir);
+    std::sort(names.begin(), names.end()); //Same order on every run
+    for (const std::string& name : names) {
+        scanSegment(directory + "/" + name);
+    }
+    return true;
+}
+
+bool EventAggregator::scanSegment(const std::string& path) {
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat info;
+    if (0 != fstat(fd, &info) ||
+        (size_t) info.st_size < sizeof(EventSegmentHeader)) {
+        close(fd);
+        return false;
+    }
+    size_t bytes = (size_t) info.st_size;
+    void * map = mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (MAP_FAILED == map) {
+        return false;
+    }
+    madvise(map, bytes, MADV_SEQUENTIAL);
+    const EventSegmentHeader * header = (const EventSegmentHeader *) map;
+    if (0 != memcmp(header->magic, EVENT_LOG_MAGIC, sizeof(EVENT_LOG_MAGIC)) ||
+        EVENT_LOG_VERSION != header->version ||
+        sizeof(RoundEvent) != header->recordBytes) {
+        munmap(map, bytes);
+        return false;
+    }
+    uint64_t count = std::atomic_ref<uint64_t>(
+    const_cast<uint64_t&>(header->count)).load(std::memory_order_acquire);
+    uint64_t room = (bytes - sizeof(EventSegmentHeader)) / sizeof(RoundEvent);
+    count = std::min(count, room); //Never trust a count past the file's end
+    const RoundEvent * events =
+    (const RoundEvent *) ((const char *) map + sizeof(EventSegmentHeader));
+    for (uint64_t i = 0u; i < count; i++) {
+        const RoundEvent& event = events[i];
+        if (event.wordLength >= MAX_DICTIONARY_WORD_LENGTH ||
+            event.transform >= SEQ_ENUM_VARIANTS ||
+            event.outcome >= ROUND_OUTCOMES) {
+            this->badRecords++;
+            continue;
+        }
+        RoundTotals& length = this->byLength[event.wordLength];
+        RoundTotals& transform = this->byTransform[event.transform];
+        length.outcomes[event.outcome]++;
+        length.guesses += event.guesses;
+        length.durationUs += event.durationUs;
+        transform.outcomes[event.outcome]++;
+        transform.guesses += event.guesses;
+        transform.durationUs += event.durationUs;
+    }
+    this->records += count;
+    this->segments++;
+    munmap(map, bytes);
+    return true;
+}
+
+void EventAggregator::report(std::ostream& out) const {
+    out << "Rounds logged: " << this->records << " in " << this->segments
+    << " segments";
+    if (this->badRecords > 0u) {
+        out << " (" << this->badRecords << " damaged records skipped)";
+    }
+    out << "\n\n" << "                 Rounds     Won    Lost    Left  "
+    "Success%  Guesses  Seconds\n";
+    char label[LABEL_BYTES];
+    for (unsigned long len = 0ul; len < MAX_DICTIONARY_WORD_LENGTH; len++) {
+        snprintf(label, sizeof(label), "%lu letters", len);
+        reportRow(label, this->byLength[len], out);
+    }
+    out << "\n";
+    for (int variant = 0; variant < SEQ_ENUM_VARIANTS; variant++) {
+        reportRow(PuzzleFactory::variantName(variant),
+                  this->byTransform[variant], out);
+    }
+    out.flush();
+}
+
+uint64_t EventAggregator::getRecords(void) const {
+    return this->records;
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+
+//Prints one row of the table, skipping rows with no rounds. Success is rounds
+//won out of rounds finished (won or lost); abandoned rounds don't count.
+void EventAggregator::reportRow(const char * label, const RoundTotals& totals,
+                                std::ostream& out) const {
+    uint64_t rounds = totals.outcomes[ROUND_WON] + totals.outcomes[ROUND_LOST] +
+                      totals.outcomes[ROUND_ABANDONED];
+    if (0u == rounds) {
+        return;
+    }
+    uint64_t finished = totals.outcomes[ROUND_WON] +
+                        totals.outcomes[ROUND_LOST];
+    double success = (0u == finished) ? 0.0 :
+    PERCENT * (double) totals.outcomes[ROUND_WON] / (double) finished;
+    char row[ROW_BYTES];
+    snprintf(row, sizeof(row), "%-14s %8llu %7llu %7llu %7llu %8.1f %8.2f "
+             "%8.3f\n", label, (unsigned long long) rounds,
+             (unsigned long long) totals.outcomes[ROUND_WON],
+             (unsigned long long) totals.outcomes[ROUND_LOST],
+             (unsigned long long) totals.outcomes[ROUND_ABANDONED], success,
+             (double) totals.guesses / (double) rounds,
+             (double) totals.durationUs / (double) rounds /
+             MICROSECONDS_PER_SECOND);
+    out << row;
+}
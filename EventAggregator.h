@@ -0,0 +1,79 @@
+// Author: Forrest Miller
+// Filename: EventAggregator.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef EventAggregator_h
+#define EventAggregator_h
+
+#include "EventLog.h"
+#include "Dictionary.h"
+#include "PuzzleFactory.h"
+#include <ostream>
+#include <stdint.h>
+#include <string>
+
+//
+// Class Overview:
+//     This class reads the round logs written by EventLog and sums them up
+//     into success rates by word length and by transform (SequenceEnum,
+//     SeqExtract or SpasEnum). Each segment is mapped read-only and its
+//     records are read front to back in one pass, which lets the kernel read
+//     ahead and keeps the loop to a handful of adds per record. Segments that
+//     are still being written can be read; only the records their header
+//     counts are used.
+//
+// Valid States include: Holding the sums of every segment scanned so far.
+//
+// Anticipated Use:  Run from main() with --aggregate DIR.
+//
+// Class Invariants:  -Every counted record is in exactly one length row and
+//                     one transform row.
+//
+// Assumptions:
+//      -Segments were written by this program's EventLog on a machine with
+//       the same byte order.
+//
+// Dependencies: EventLog, Dictionary, PuzzleFactory
+//
+
+struct RoundTotals {
+    uint64_t outcomes[ROUND_OUTCOMES]; //Rounds won, lost and abandoned
+    uint64_t guesses;
+    uint64_t durationUs;
+};
+
+class EventAggregator {
+private:
+    RoundTotals byLength[MAX_DICTIONARY_WORD_LENGTH];
+    RoundTotals byTransform[SEQ_ENUM_VARIANTS];
+    uint64_t segments;
+    uint64_t records;
+    uint64_t badRecords;
+
+    void reportRow(const char * label, const RoundTotals&,
+                   std::ostream& out) const;
+public:
+    EventAggregator(void);
+    //Description: Constructs an aggregator with every sum at zero
+
+    bool scanDirectory(const std::string& directory);
+    //Description: Adds in every segment file in the directory
+    //Preconditions: None
+    //Postconditions: Returns false (after printing why) if the directory
+    //                can't be read. Unreadable segments are skipped.
+
+    bool scanSegment(const std::string& path);
+    //Description: Adds in the records of one segment file
+    //Preconditions: None
+    //Postconditions: Returns false if the file isn't a readable segment
+
+    void report(std::ostream& out) const;
+    //Description: Prints rounds, success rate, average guesses and average
+    //             round time for each word length and each transform
+
+    uint64_t getRecords(void) const;
+    //Description: Returns the number of records counted
+};
+
+#endif /* EventAggregator_h */
@@ -0,0 +1,237 @@
+// Author: Forrest Miller
+// Filename: EventLog.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "EventLog.h"
+#include <atomic>
+#include <errno.h>
+#include <fcntl.h>
+#include <iostream>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the EventLog
+//          class. The count in the header is stored with release ordering
+//          after the record is copied, so a reader that loads the count with
+//          acquire ordering never sees a half written record. The owning
+//          thread and the helper only hand segments to each other under
+//          preparerLock, and the owner takes it just twice per segment.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+static_assert(sizeof(RoundEvent) == 32, "RoundEvent is a fixed 32 bytes");
+static_assert(sizeof(EventSegmentHeader) == 64, "Header is one cache line");
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const int SEGMENT_NAME_BYTES = 64;
+const int NO_SEGMENT = -1;
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+EventLog::EventLog(const std::string& logDirectory, int writer,
+                   uint64_t perSegment) {
+    this->directory = logDirectory;
+    this->writerId = writer;
+    this->eventsPerSegment = perSegment;
+    this->segmentNumber = NO_SEGMENT;
+    this->current.mapped = nullptr;
+    this->current.mappedBytes = 0u;
+    this->header = nullptr;
+    this->records = nullptr;
+    this->count = 0u;
+    this->prepareRequested = false;
+    this->next.mapped = nullptr;
+    this->next.mappedBytes = 0u;
+    this->retired.mapped = nullptr;
+    this->retired.mappedBytes = 0u;
+    this->stopRequested = false;
+}
+
+EventLog::~EventLog(void) {
+    stopPreparer();
+    unmapSegment(this->current);
+    if (nullptr != this->next.mapped) { //Made ahead but never written to
+        unmapSegment(this->next);
+        unlink(this->next.path.c_str());
+    }
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+bool EventLog::open(void) {
+    EventSegment first;
+    if (!makeSegment(this->segmentNumber + 1, first)) {
+        return false;
+    }
+    useSegment(first);
+    this->preparer = std::thread(&EventLog::prepareLoop, this);
+    return true;
+}
+
+void EventLog::append(const RoundEvent& event) {
+    if (nullptr == this->records) {
+        return;
+    }
+    if (this->count == this->eventsPerSegment && !switchSegment()) {
+        return; //Out of disk; logging stops but the game goes on
+    }
+    memcpy(&this->records[this->count], &event, sizeof(event));
+    this->count++;
+    std::atomic_ref<uint64_t>(this->header->count).store(
+                                    this->count, std::memory_order_release);
+    if (this->count == (this->eventsPerSegment + 1u) / 2u) {
+        requestNextSegment(); //Half full: have the helper make the next one
+    }
+}
+
+bool EventLog::isOpen(void) const {
+    return nullptr != this->records;
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+
+//Creates, sizes and maps a segment file and writes its header
+bool EventLog::makeSegment(int number, EventSegment& segment) const {
+    char name[SEGMENT_NAME_BYTES];
+    snprintf(name, sizeof(name), "%s%d-%d-%06d%s", EVENT_LOG_FILE_PREFIX,
+             (int) getpid(), this->writerId, number, EVENT_LOG_FILE_SUFFIX);
+    segment.path = this->directory + "/" + name;
+    segment.mapped = nullptr;
+    segment.mappedBytes = 0u;
+    size_t bytes = sizeof(EventSegmentHeader) +
+                   (size_t) this->eventsPerSegment * sizeof(RoundEvent);
+    int fd = ::open(segment.path.c_str(),
+                    O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        std::cerr << "Could not create " << segment.path << ": "
+        << strerror(errno) << std::endl;
+        return false;
+    }
+    //Reserve the blocks now: a store into a sparse page on a full disk
+    //would kill the process with SIGBUS instead of failing here
+    int reserved = posix_fallocate(fd, 0, (off_t) bytes);
+    void * map = MAP_FAILED;
+    if (0 == reserved) {
+        map = mmap(nullptr, bytes, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, fd, 0);
+    }
+    close(fd); //The mapping keeps the file open
+    if (MAP_FAILED == map) {
+        std::cerr << "Could not map " << segment.path << ": "
+        << strerror(0 != reserved ? reserved : errno) << std::endl;
+        unlink(segment.path.c_str());
+        return false;
+    }
+    segment.mapped = map;
+    segment.mappedBytes = bytes;
+    EventSegmentHeader * made = (EventSegmentHeader *) map;
+    memcpy(made->magic, EVENT_LOG_MAGIC, sizeof(EVENT_LOG_MAGIC));
+    made->version = EVENT_LOG_VERSION;
+    made->recordBytes = (uint32_t) sizeof(RoundEvent);
+    made->capacity = this->eventsPerSegment;
+    std::atomic_ref<uint64_t>(made->count).store(0u,
+                                                 std::memory_order_release);
+    return true;
+}
+
+void EventLog::unmapSegment(EventSegment& segment) {
+    if (nullptr != segment.mapped) {
+        munmap(segment.mapped, segment.mappedBytes);
+    }
+    segment.mapped = nullptr;
+}
+
+//Makes the segment the one appends go to
+void EventLog::useSegment(EventSegment& segment) {
+    this->segmentNumber++;
+    this->current = segment;
+    this->header = (EventSegmentHeader *) segment.mapped;
+    this->records = (RoundEvent *) ((char *) segment.mapped +
+                                    sizeof(EventSegmentHeader));
+    this->count = 0u;
+}
+
+void EventLog::requestNextSegment(void) {
+    {
+        std::lock_guard<std::mutex> guard(this->preparerLock);
+        this->prepareRequested = true;
+    }
+    this->preparerWake.notify_one();
+}
+
+//Swaps the full segment for the one made ahead, leaving the full one for the
+//helper to unmap. Returns false, and stops logging, if it couldn't be made.
+bool EventLog::switchSegment(void) {
+    std::unique_lock<std::mutex> lock(this->preparerLock);
+    //Only waits if the helper is still making the segment (or hasn't yet
+    //unmapped the one before)
+    this->preparerWake.wait(lock, [this] {
+        return !this->prepareRequested && nullptr == this->retired.mapped;
+    });
+    this->retired = this->current;
+    this->current.mapped = nullptr;
+    this->header = nullptr;
+    this->records = nullptr;
+    if (nullptr != this->next.mapped) {
+        useSegment(this->next);
+        this->next.mapped = nullptr;
+    }
+    lock.unlock();
+    this->preparerWake.notify_one();
+    return nullptr != this->records;
+}
+
+//The helper thread: makes the next segment when asked and unmaps retired
+//ones, without holding the lock while it does either
+void EventLog::prepareLoop(void) {
+    std::unique_lock<std::mutex> lock(this->preparerLock);
+    while (true) {
+        this->preparerWake.wait(lock, [this] {
+            return this->stopRequested || this->prepareRequested ||
+                   nullptr != this->retired.mapped;
+        });
+        if (nullptr != this->retired.mapped) {
+            EventSegment full = this->retired;
+            lock.unlock();
+            unmapSegment(full);
+            lock.lock();
+            this->retired.mapped = nullptr;
+        }
+        else if (this->prepareRequested) {
+            int number = this->segmentNumber + 1;
+            lock.unlock();
+            EventSegment made;
+            makeSegment(number, made);
+            lock.lock();
+            this->next = made;
+            this->prepareRequested = false;
+        }
+        else {
+            break; //Stop requested and nothing left to do
+        }
+        this->preparerWake.notify_all(); //A switch may be waiting
+    }
+}
+
+void EventLog::stopPreparer(void) {
+    {
+        std::lock_guard<std::mutex> guard(this->preparerLock);
+        this->stopRequested = true;
+    }
+    this->preparerWake.notify_all();
+    if (this->preparer.joinable()) {
+        this->preparer.join();
+    }
+}
@@ -0,0 +1,147 @@
+// Author: Forrest Miller
+// Filename: EventLog.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef EventLog_h
+#define EventLog_h
+
+#include <condition_variable>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <thread>
+
+//
+// Class Overview:
+//     This class keeps a permanent record of every round played, so scores
+//     outlive the session that earned them. Each round becomes one fixed-size
+//     RoundEvent appended to a segment file that is mapped into memory:
+//     appending is a memcpy into the mapping followed by bumping the count in
+//     the segment's header, with no system call and no lock, so logging can't
+//     hold up the game loop. Creating a segment (opening, pre-allocating and
+//     pre-faulting it) is slow, so a helper thread makes the next one as soon
+//     as the current one is half full and unmaps the old one after the
+//     switch; when a segment fills up, the append just starts writing into
+//     the one made ahead. The kernel writes the pages back to disk on its
+//     own.
+//     Segments are named
+//        events-<process id>-<writer id>-<segment number>.log
+//     so every thread (and every run) writes its own files, and an
+//     EventAggregator can read them all, even while they are being written.
+//
+// Valid States include: Not open, or open with a mapped segment (and the
+//                       helper thread running).
+//
+// Anticipated Use:  One per thread that plays games (the terminal game, each
+//                   server event loop, each load test worker).
+//
+// Class Invariants:  -Records before the header's count are complete.
+//                    -Only the owning thread appends.
+//                    -The helper only touches the next and retired segments,
+//                     and only the owning thread touches the current one.
+//
+// Assumptions:
+//      -The directory exists and is writable.
+//
+// Dependencies: None
+//
+
+const int ROUND_WON = 0;       //Values of RoundEvent::outcome
+const int ROUND_LOST = 1;      //Out of guesses
+const int ROUND_ABANDONED = 2; //Player left part way through
+const int ROUND_OUTCOMES = 3;
+
+struct RoundEvent {
+    uint64_t finishedAtNs;  //Wall clock when the round ended (ns since 1970)
+    uint32_t durationUs;    //From showing the puzzle to the round's end
+    uint32_t wordIndex;     //The word's index among words of its length
+    uint8_t wordLength;
+    uint8_t transform;      //DO_SEQ_ENUM, DO_SEQ_EXTRACT or DO_SPAS_ENUM
+    uint8_t guesses;        //Guesses made, counting a correct one
+    uint8_t outcome;        //ROUND_WON, ROUND_LOST or ROUND_ABANDONED
+    uint32_t round;         //1 for a session's first round, and so on
+    uint64_t reserved;      //Zero; room to grow without a format change
+};
+
+struct EventSegmentHeader {
+    char magic[8];          //EVENT_LOG_MAGIC
+    uint32_t version;
+    uint32_t recordBytes;   //sizeof(RoundEvent)
+    uint64_t capacity;      //Records the segment has room for
+    uint64_t count;         //Records written so far (updated atomically)
+    uint8_t unused[32];     //Pads the header to 64 bytes
+};
+
+const char EVENT_LOG_MAGIC[8] = {'P', '4', 'E', 'V', 'E', 'N', 'T', 'S'};
+const uint32_t EVENT_LOG_VERSION = 1u;
+const uint64_t DEFAULT_EVENTS_PER_SEGMENT = 65536u; //2 MB segments
+const char EVENT_LOG_FILE_PREFIX[] = "events-";
+const char EVENT_LOG_FILE_SUFFIX[] = ".log";
+
+class EventLog {
+private:
+    struct EventSegment {
+        std::string path;
+        void * mapped;      //nullptr when there is no segment
+        size_t mappedBytes;
+    };
+
+    std::string directory;
+    int writerId;
+    uint64_t eventsPerSegment;
+    int segmentNumber;      //The current segment's
+    EventSegment current;
+    EventSegmentHeader * header;
+    RoundEvent * records;
+    uint64_t count;         //Writer's own copy of header->count
+
+    //Helper state, guarded by preparerLock
+    std::thread preparer;
+    std::mutex preparerLock;
+    std::condition_variable preparerWake;
+    bool prepareRequested;  //Make segment segmentNumber + 1
+    EventSegment next;      //Made ahead (unmapped if making it failed)
+    EventSegment retired;   //Full; waiting to be unmapped
+    bool stopRequested;
+
+    bool makeSegment(int number, EventSegment& segment) const;
+    static void unmapSegment(EventSegment& segment);
+    void useSegment(EventSegment& segment);
+    void requestNextSegment(void);
+    bool switchSegment(void);
+    void prepareLoop(void);
+    void stopPreparer(void);
+
+    EventLog(const EventLog&);
+    EventLog& operator=(const EventLog&);
+public:
+    EventLog(const std::string& directory, int writerId,
+             uint64_t eventsPerSegment = DEFAULT_EVENTS_PER_SEGMENT);
+    //Description: Constructs a log that will write into the directory
+    //Preconditions: eventsPerSegment is greater than 0
+    //Postconditions: Log is not open
+
+    ~EventLog(void);
+    //Description: Stops the helper and unmaps the segments (their records
+    //             stay on disk; one made ahead and never used is removed)
+
+    bool open(void);
+    //Description: Creates and maps the first segment and starts the helper
+    //Preconditions: Not already open
+    //Postconditions: Returns false (after printing why) if it couldn't
+
+    void append(const RoundEvent& event);
+    //Description: Copies the event into the log, moving on to the segment
+    //             made ahead when the current one is full (waiting for the
+    //             helper only if it is still making it)
+    //Preconditions: Called only by the owning thread
+    //Postconditions: The event is visible to readers. Events are dropped
+    //                (silently) if the log isn't open.
+
+    bool isOpen(void) const;
+    //Description: Returns true while a segment is mapped
+};
+
+#endif /* EventLog_h */
@@ -0,0 +1,85 @@
+// Author: Forrest Miller
+// Filename: FastRandom.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "FastRandom.h"
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the FastRandom class.
+//          The algorithms are xoshiro256** and splitmix64 by Blackman and
+//          Vigna, and the unbiased bounded draw is from Lemire's "Fast Random
+//          Integer Generation in an Interval".
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const uint64_t SPLITMIX_INCREMENT = 0x9E3779B97F4A7C15ull;
+const uint64_t SPLITMIX_MULT_ONE = 0xBF58476D1CE4E5B9ull;
+const uint64_t SPLITMIX_MULT_TWO = 0x94D049BB133111EBull;
+const int BITS_IN_WORD = 64;
+const int BITS_IN_HALF_WORD = 32;
+const int DOUBLE_MANTISSA_SHIFT = 11; //Keep the top 53 bits for a double
+const double TWO_TO_MINUS_53 = 1.0 / 9007199254740992.0;
+
+static inline uint64_t rotateLeft(uint64_t x, int k) {
+    return (x << k) | (x >> (BITS_IN_WORD - k));
+}
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+FastRandom::FastRandom(uint64_t seed) {
+    reseed(seed);
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+void FastRandom::reseed(uint64_t seed) {
+    for (int i = 0; i < 4; i++) {
+        this->state[i] = splitMix(seed);
+    }
+}
+
+uint64_t FastRandom::next(void) {
+    const uint64_t result = rotateLeft(this->state[1] * 5u, 7) * 9u;
+    const uint64_t t = this->state[1] << 17;
+    this->state[2] ^= this->state[0];
+    this->state[3] ^= this->state[1];
+    this->state[1] ^= this->state[2];
+    this->state[0] ^= this->state[3];
+    this->state[2] ^= t;
+    this->state[3] = rotateLeft(this->state[3], 45);
+    return result;
+}
+
+uint32_t FastRandom::nextBelow(uint32_t bound) {
+    uint64_t product = (next() >> BITS_IN_HALF_WORD) * (uint64_t) bound;
+    uint32_t low = (uint32_t) product;
+    if (low < bound) {
+        //Only values below (2^32 mod bound) would make the result biased
+        uint32_t threshold = (uint32_t) (-bound) % bound;
+        while (low < threshold) {
+            product = (next() >> BITS_IN_HALF_WORD) * (uint64_t) bound;
+            low = (uint32_t) product;
+        }
+    }
+    return (uint32_t) (product >> BITS_IN_HALF_WORD);
+}
+
+double FastRandom::nextUnit(void) {
+    return (double) (next() >> DOUBLE_MANTISSA_SHIFT) * TWO_TO_MINUS_53;
+}
+
+uint64_t FastRandom::splitMix(uint64_t& seed) {
+    seed += SPLITMIX_INCREMENT;
+    uint64_t z = seed;
+    z = (z ^ (z >> 30)) * SPLITMIX_MULT_ONE;
+    z = (z ^ (z >> 27)) * SPLITMIX_MULT_TWO;
+    return z ^ (z >> 31);
+}
@@ -0,0 +1,72 @@
+// Author: Forrest Miller
+// Filename: FastRandom.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef FastRandom_h
+#define FastRandom_h
+
+#include <stdint.h>
+
+//
+// Class Overview:
+//     This class is a small, fast pseudo-random number generator
+//     (xoshiro256**, seeded through splitmix64). Unlike rand(), every object
+//     has its own state, so each thread can own a generator and draw numbers
+//     without sharing anything. It also offers bounded draws that are free of
+//     the modulo bias that 'rand() % n' has.
+//
+// Valid States include: Any seed (including 0) produces a valid generator.
+//
+// Anticipated Use:  Word selection on every round, and any code that needs
+//                   random numbers off the main thread.
+//
+// Class Invariants:  -The internal state is never all zeros (splitmix64 seeding
+//                     guarantees this).
+//                    -The same seed always produces the same sequence.
+//
+// Assumptions:
+//      -One generator is used by one thread at a time.
+//
+// Dependencies: None
+//
+
+class FastRandom {
+private:
+    uint64_t state[4];
+public:
+    FastRandom(uint64_t seed);
+    //Description: Constructs the generator from a seed
+    //Preconditions: None
+    //Postconditions: Generator is ready to draw
+
+    void reseed(uint64_t seed);
+    //Description: Restarts the generator as if it had been constructed with
+    //             the seed
+    //Preconditions: None
+    //Postconditions: Next draws match a newly constructed generator's
+
+    uint64_t next(void);
+    //Description: Returns 64 uniformly distributed random bits
+    //Preconditions: None
+    //Postconditions: Generator state advances
+
+    uint32_t nextBelow(uint32_t bound);
+    //Description: Returns a uniformly distributed value in [0, bound) without
+    //             modulo bias (Lemire's multiply-shift with rejection)
+    //Preconditions: bound must be greater than 0
+    //Postconditions: Generator state advances one or more steps
+
+    double nextUnit(void);
+    //Description: Returns a uniformly distributed double in [0, 1)
+    //Preconditions: None
+    //Postconditions: Generator state advances
+
+    static uint64_t splitMix(uint64_t& seed);
+    //Description: Advances a splitmix64 sequence and returns its next value.
+    //             Handy for deriving independent seeds from one master seed.
+    //Preconditions: None
+    //Postconditions: seed is advanced
+};
+
+#endif /* FastRandom_h */
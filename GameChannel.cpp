@@ -0,0 +1,128 @@
+// Author: Forrest Miller
+// Filename: GameChannel.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "GameChannel.h"
+#include <cctype>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the GameChannel
+//          class. A game waiting for a token is only resumed once a line with
+//          a token (or the end of input) arrives; blank lines in front of it
+//          are dropped, just as 'std::cin >>' skips them.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//Returns the first whitespace separated token of the line (may be empty)
+static std::string firstToken(const std::string& line) {
+    unsigned long start = 0ul;
+    while (start < line.length() && std::isspace((unsigned char) line[start])) {
+        start++;
+    }
+    unsigned long end = start;
+    while (end < line.length() && !std::isspace((unsigned char) line[end])) {
+        end++;
+    }
+    return line.substr(start, end - start);
+}
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+GameChannel::LineAwaiter::LineAwaiter(GameChannel& source, bool token)
+: channel(source) {
+    this->wantToken = token;
+}
+
+GameChannel::GameChannel(void) {
+    this->closed = false;
+    this->waitingForToken = false;
+}
+
+GameChannel::~GameChannel(void) {
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+bool GameChannel::LineAwaiter::await_ready(void) {
+    while (!this->channel.hasInputFor(this->wantToken)) {
+        this->channel.flush(); //Show the prompt before a blocking read
+        if (!this->channel.readMore()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void GameChannel::LineAwaiter::await_suspend(std::coroutine_handle<> waiter) {
+    this->channel.waiting = waiter;
+    this->channel.waitingForToken = this->wantToken;
+}
+
+std::optional<std::string> GameChannel::LineAwaiter::await_resume(void) {
+    if (this->channel.lines.empty()) {
+        return std::nullopt; //Closed and out of input
+    }
+    std::string line = this->channel.lines.front();
+    this->channel.lines.pop_front();
+    if (this->wantToken) {
+        return firstToken(line);
+    }
+    return line;
+}
+
+GameChannel::LineAwaiter GameChannel::nextLine(void) {
+    return LineAwaiter(*this, false);
+}
+
+GameChannel::LineAwaiter GameChannel::nextToken(void) {
+    return LineAwaiter(*this, true);
+}
+
+void GameChannel::pushLine(const std::string& line) {
+    this->lines.push_back(line);
+    resumeIfReady();
+}
+
+void GameChannel::close(void) {
+    this->closed = true;
+    resumeIfReady();
+}
+
+bool GameChannel::isClosed(void) const {
+    return this->closed;
+}
+
+OutputBuffer& GameChannel::getOutput(void) {
+    return this->output;
+}
+
+void GameChannel::flush(void) {
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+bool GameChannel::readMore(void) {
+    return false;
+}
+
+bool GameChannel::hasInputFor(bool wantToken) {
+    while (wantToken && !this->lines.empty() &&
+           firstToken(this->lines.front()).empty()) {
+        this->lines.pop_front();
+    }
+    return !this->lines.empty() || this->closed;
+}
+
+void GameChannel::resumeIfReady(void) {
+    if (this->waiting && hasInputFor(this->waitingForToken)) {
+        std::coroutine_handle<> waiter = this->waiting;
+        this->waiting = nullptr;
+        waiter.resume();
+    }
+}
@@ -0,0 +1,111 @@
+// Author: Forrest Miller
+// Filename: GameChannel.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef GameChannel_h
+#define GameChannel_h
+
+#include "OutputBuffer.h"
+#include <coroutine>
+#include <deque>
+#include <optional>
+#include <string>
+
+//
+// Class Overview:
+//     This class is where a game gets its input lines from and puts its
+//     output, so the game's rules can be written once as a coroutine that
+//     co_awaits its next line without knowing who is on the other end. Lines
+//     arrive in one of two ways:
+//        -Pushed in by the owner with pushLine() (the server does this as
+//         bytes arrive). A waiting game is resumed right there.
+//        -Pulled in by a subclass's readMore() when the game asks for input
+//         that isn't there yet (the terminal blocks on std::cin here).
+//     Output is appended to an OutputBuffer that the owner writes out in one
+//     go; flush() is called just before a pull so prompts appear before the
+//     read.
+//
+// Valid States include: Open or closed. A closed channel still hands out the
+//                       lines it already holds, then reports end of input.
+//
+// Anticipated Use:  Subclassed by TerminalChannel and ScriptedChannel, and
+//                   used directly (push only) by the server.
+//
+// Class Invariants:  -At most one coroutine waits on the channel at a time.
+//
+// Assumptions:
+//      -The channel outlives any coroutine waiting on it.
+//
+// Dependencies: OutputBuffer
+//
+
+class GameChannel {
+public:
+    class LineAwaiter {
+    private:
+        GameChannel& channel;
+        bool wantToken;
+    public:
+        LineAwaiter(GameChannel&, bool wantToken);
+        bool await_ready(void);
+        void await_suspend(std::coroutine_handle<> waiter);
+        std::optional<std::string> await_resume(void);
+    };
+
+private:
+    std::deque<std::string> lines;
+    OutputBuffer output;
+    bool closed;
+    std::coroutine_handle<> waiting;
+    bool waitingForToken;
+
+    bool hasInputFor(bool wantToken);
+    void resumeIfReady(void);
+
+    GameChannel(const GameChannel&);
+    GameChannel& operator=(const GameChannel&);
+protected:
+    virtual bool readMore(void);
+    //Description: Called when a game wants input and none is held. Blocking
+    //             sources read a line into pushLine() (or call close()) and
+    //             return true. The default returns false, meaning the game
+    //             must wait for the owner to push a line.
+public:
+    GameChannel(void);
+    //Description: Constructs an open channel holding no input or output
+
+    virtual ~GameChannel(void);
+
+    LineAwaiter nextLine(void);
+    //Description: co_await this for the next whole line (which may be blank).
+    //             Gives std::nullopt once the channel is closed and empty.
+
+    LineAwaiter nextToken(void);
+    //Description: co_await this for the first whitespace separated word of
+    //             the next line that has one, like 'std::cin >>' would read.
+    //             Gives std::nullopt once the channel is closed and empty.
+
+    void pushLine(const std::string& line);
+    //Description: Adds a line (without its newline) and resumes the waiting
+    //             game if this satisfies what it is waiting for
+    //Preconditions: Not called from inside the waiting game
+    //Postconditions: The game may have run and added output
+
+    void close(void);
+    //Description: Marks the end of input and resumes the waiting game, which
+    //             sees std::nullopt once the held lines run out
+
+    bool isClosed(void) const;
+    //Description: Returns true once close() has been called
+
+    OutputBuffer& getOutput(void);
+    //Description: Returns the output written by the game so far. The owner
+    //             writes it out (which drops what was written).
+
+    virtual void flush(void);
+    //Description: Delivers pending output. The default does nothing, since
+    //             push-only owners send getOutput() themselves.
+};
+
+#endif /* GameChannel_h */
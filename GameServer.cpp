@@ -0,0 +1,348 @@
+// Author: Forrest Miller
+// Filename: GameServer.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "GameServer.h"
+#include <errno.h>
+#include <iostream>
+#include <string.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the GameServer
+//          class. The loops are level triggered: a connection is watched
+//          for input until its unsent replies pass a cap (a player who never
+//          reads would otherwise grow them without bound), and only watched
+//          for output while a reply is only partly sent. Stopping writes to an
+//          eventfd that every loop watches and nobody reads, so it wakes
+//          them all.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const int NO_SOCKET = -1;
+const int EVENTS_PER_WAIT = 256;
+const int WAIT_FOREVER = -1;
+const size_t READ_CHUNK_BYTES = 4096;
+const size_t MAX_LINE_BYTES = 1024; //Longer lines close the connection
+const size_t MAX_PENDING_OUTPUT_BYTES = 64 * 1024; //Then stop reading
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+GameServer::Connection::Connection(int socketFd, EpochCorpus& epochs,
+                                   int readerSlot, FastRandom& rng,
+                                   EventLog * events, StatsShard * stats)
+: session(epochs, readerSlot, rng, nullptr, events, stats),
+  game(session.play(channel)) {
+    this->fd = socketFd;
+    this->wantsRead = true;
+    this->wantsWrite = false;
+}
+
+GameServer::GameServer(EpochCorpus& epochs, uint64_t serverSeed)
+: corpusEpochs(epochs) {
+    this->seed = serverSeed;
+    this->listenFd = NO_SOCKET;
+    this->wakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    this->keepServing = false;
+}
+
+GameServer::~GameServer(void) {
+    stop();
+    if (NO_SOCKET != this->listenFd) {
+        close(this->listenFd);
+    }
+    if (NO_SOCKET != this->wakeFd) {
+        close(this->wakeFd);
+    }
+    if (!this->unixPath.empty()) {
+        unlink(this->unixPath.c_str());
+    }
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+bool GameServer::listenTcp(int port) {
+    int fd = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        std::cerr << "socket: " << strerror(errno) << std::endl;
+        return false;
+    }
+    int on = 1;
+    setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_ANY);
+    address.sin_port = htons((uint16_t) port);
+    if (bind(fd, (sockaddr *) &address, sizeof(address)) < 0 ||
+        listen(fd, SOMAXCONN) < 0) {
+        std::cerr << "Could not listen on port " << port << ": ";
+        std::cerr << strerror(errno) << std::endl;
+        close(fd);
+        return false;
+    }
+    this->listenFd = fd;
+    return true;
+}
+
+bool GameServer::listenUnix(const std::string& path) {
+    sockaddr_un address;
+    memset(&address, 0, sizeof(address));
+    if (path.empty() || path.length() >= sizeof(address.sun_path)) {
+        std::cerr << "Bad socket path: " << path << std::endl;
+        return false;
+    }
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        std::cerr << "socket: " << strerror(errno) << std::endl;
+        return false;
+    }
+    address.sun_family = AF_UNIX;
+    memcpy(address.sun_path, path.c_str(), path.length());
+    unlink(path.c_str()); //Left behind if a previous server was killed
+    if (bind(fd, (sockaddr *) &address, sizeof(address)) < 0 ||
+        listen(fd, SOMAXCONN) < 0) {
+        std::cerr << "Could not listen on " << path << ": ";
+        std::cerr << strerror(errno) << std::endl;
+        close(fd);
+        return false;
+    }
+    this->listenFd = fd;
+    this->unixPath = path;
+    return true;
+}
+
+void GameServer::setEventLogDirectory(const std::string& directory) {
+    this->eventLogDirectory = directory;
+}
+
+void GameServer::start(unsigned int threads) {
+    if (!this->loops.empty() || NO_SOCKET == this->listenFd) {
+        return;
+    }
+    if (0u == threads) {
+        threads = std::thread::hardware_concurrency();
+    }
+    if (0u == threads) {
+        threads = 1u;
+    }
+    this->keepServing = true;
+    for (unsigned int i = 0u; i < threads; i++) {
+        this->loops.push_back(std::thread(&GameServer::runLoop, this, i));
+    }
+}
+
+const GameStats& GameServer::getStats(void) const {
+    return this->stats;
+}
+
+void GameServer::stop(void) {
+    this->keepServing = false;
+    uint64_t wake = 1ull;
+    if (write(this->wakeFd, &wake, sizeof(wake)) < 0) {
+        //Counter is already non-zero, so the loops are awake anyway
+    }
+    for (std::thread& loop : this->loops) {
+        loop.join();
+    }
+    this->loops.clear();
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+void GameServer::runLoop(unsigned int loopIndex) {
+    int readerSlot = this->corpusEpochs.registerReader();
+    if (NO_READER_SLOT == readerSlot) {
+        std::cerr << "Event loop " << loopIndex << " has no corpus reader slot"
+        " and will not serve" << std::endl;
+        return;
+    }
+    uint64_t loopSeed = this->seed + (uint64_t) loopIndex;
+    FastRandom rng(FastRandom::splitMix(loopSeed));
+    std::unique_ptr<EventLog> roundLog;
+    if (!this->eventLogDirectory.empty()) {
+        roundLog.reset(new EventLog(this->eventLogDirectory, (int) loopIndex));
+        if (!roundLog->open()) {
+            roundLog.reset(); //Serve anyway, just without the log
+        }
+    }
+    LoopState loop = {readerSlot, &rng, roundLog.get(),
+                      this->stats.claimShard()};
+    int epollFd = epoll_create1(EPOLL_CLOEXEC);
+    epoll_event event;
+    memset(&event, 0, sizeof(event));
+    event.events = EPOLLIN | EPOLLEXCLUSIVE;
+    event.data.fd = this->listenFd;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, this->listenFd, &event);
+    event.events = EPOLLIN;
+    event.data.fd = this->wakeFd;
+    epoll_ctl(epollFd, EPOLL_CTL_ADD, this->wakeFd, &event);
+
+    ConnTable connections;
+    epoll_event events[EVENTS_PER_WAIT];
+    while (this->keepServing.load()) {
+        int ready = epoll_wait(epollFd, events, EVENTS_PER_WAIT, WAIT_FOREVER);
+        for (int i = 0; i < ready; i++) {
+            int fd = events[i].data.fd;
+            if (fd == this->wakeFd) {
+                continue; //keepServing has been cleared
+            }
+            if (fd == this->listenFd) {
+                acceptConnections(epollFd, connections, loop);
+                continue;
+            }
+            ConnTable::iterator found = connections.find(fd);
+            if (found == connections.end()) {
+                continue;
+            }
+            Connection& conn = *found->second;
+            bool keepOpen = true;
+            if (events[i].events & (EPOLLIN | EPOLLERR | EPOLLHUP)) {
+                keepOpen = readFrom(conn);
+            }
+            keepOpen = writeTo(epollFd, conn) && keepOpen;
+            if (!keepOpen || (conn.game.isDone() && !conn.wantsWrite)) {
+                closeConnection(epollFd, connections, fd);
+            }
+        }
+    }
+    for (ConnTable::value_type& entry : connections) {
+        entry.second->channel.close(); //Lets each game log its last round
+        close(entry.first);
+    }
+    connections.clear(); //No session may count into the shard after this
+    close(epollFd);
+    this->stats.releaseShard(loop.stats);
+    this->corpusEpochs.unregisterReader(readerSlot);
+}
+
+void GameServer::acceptConnections(int epollFd, ConnTable& connections,
+                                   const LoopState& loop) {
+    while (true) {
+        int fd = accept4(this->listenFd, nullptr, nullptr,
+                         SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            return; //EAGAIN, or out of descriptors until someone leaves
+        }
+        int on = 1; //Replies are whole rounds, don't hold them back
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+        Connection * conn = new Connection(fd, this->corpusEpochs,
+                                           loop.readerSlot, *loop.rng,
+                                           loop.events, loop.stats);
+        connections[fd].reset(conn); //The game has already sent its welcome
+        epoll_event event;
+        memset(&event, 0, sizeof(event));
+        event.events = EPOLLIN;
+        event.data.fd = fd;
+        epoll_ctl(epollFd, EPOLL_CTL_ADD, fd, &event);
+        if (!writeTo(epollFd, *conn)) {
+            closeConnection(epollFd, connections, fd);
+        }
+    }
+}
+
+//Reads one chunk at a time and hands each complete line to the game, until
+//the socket is drained or the unsent replies pass the cap; the rest stays in
+//the socket until writeTo() watches for input again. Returns false if the
+//player hung up or the connection failed.
+bool GameServer::readFrom(Connection& conn) {
+    char chunk[READ_CHUNK_BYTES];
+    OutputBuffer& output = conn.channel.getOutput();
+    while (output.length() <= MAX_PENDING_OUTPUT_BYTES &&
+           !conn.game.isDone()) {
+        ssize_t got = recv(conn.fd, chunk, sizeof(chunk), 0);
+        if (got > 0) {
+            conn.input.append(chunk, (size_t) got);
+            if (!pushLines(conn)) {
+                return false;
+            }
+            continue;
+        }
+        if (got < 0 && (EAGAIN == errno || EWOULDBLOCK == errno)) {
+            break;
+        }
+        if (got < 0 && EINTR == errno) {
+            continue;
+        }
+        return false; //Closed by the player or failed
+    }
+    return true;
+}
+
+//Hands each complete line in the input to the game. Returns false if what is
+//left is already longer than any line may be.
+bool GameServer::pushLines(Connection& conn) {
+    size_t lineStart = 0;
+    size_t newline;
+    while ((newline = conn.input.find('\n', lineStart)) != std::string::npos) {
+        size_t lineEnd = newline;
+        if (lineEnd > lineStart && '\r' == conn.input[lineEnd - 1]) {
+            lineEnd--;
+        }
+        std::string line = conn.input.substr(lineStart, lineEnd - lineStart);
+        lineStart = newline + 1;
+        conn.channel.pushLine(line); //Resumes the game if it was waiting
+        if (conn.game.isDone()) {
+            break;
+        }
+    }
+    conn.input.erase(0, lineStart);
+    return conn.input.length() <= MAX_LINE_BYTES;
+}
+
+//Sends as much pending output as the socket takes, one sendmsg() per try.
+//Watches for writability only while some is left, and for input only while
+//what is left is under the cap. Returns false if the send failed.
+bool GameServer::writeTo(int epollFd, Connection& conn) {
+    OutputBuffer& output = conn.channel.getOutput();
+    while (!output.empty()) {
+        if (output.sendTo(conn.fd) >= 0) {
+            continue;
+        }
+        if (EAGAIN == errno || EWOULDBLOCK == errno) {
+            break;
+        }
+        if (EINTR != errno) {
+            return false;
+        }
+    }
+    bool pending = !output.empty();
+    bool roomLeft = output.length() <= MAX_PENDING_OUTPUT_BYTES;
+    if (pending != conn.wantsWrite || roomLeft != conn.wantsRead) {
+        epoll_event event;
+        memset(&event, 0, sizeof(event));
+        event.events = (roomLeft ? EPOLLIN : 0u) | (pending ? EPOLLOUT : 0u);
+        event.data.fd = conn.fd;
+        epoll_ctl(epollFd, EPOLL_CTL_MOD, conn.fd, &event);
+        conn.wantsWrite = pending;
+        conn.wantsRead = roomLeft;
+    }
+    return true;
+}
+
+void GameServer::closeConnection(int epollFd, ConnTable& connections,
+                                 int fd) {
+    ConnTable::iterator found = connections.find(fd);
+    if (found != connections.end()) {
+        found->second->channel.close(); //Ends a game the player walked out of
+    }
+    epoll_ctl(epollFd, EPOLL_CTL_DEL, fd, nullptr);
+    close(fd);
+    connections.erase(fd);
+}
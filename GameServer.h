@@ -0,0 +1,141 @@
+// Author: Forrest Miller
+// Filename: GameServer.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef GameServer_h
+#define GameServer_h
+
+#include "GameSession.h"
+#include "GameChannel.h"
+#include "GameTask.h"
+#include "GameStats.h"
+#include "EpochCorpus.h"
+#include "FastRandom.h"
+#include <atomic>
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+//
+// Class Overview:
+//     This class serves the guessing game to many players at once over a TCP
+//     port or a Unix-domain socket. Each event loop thread owns an epoll
+//     instance and the connections it accepted; every connection runs a
+//     GameSession coroutine that sleeps until its GameChannel is pushed the
+//     next line, so a loop never blocks on a slow player and a waiting game
+//     costs only its coroutine frame. All loops share the listening socket
+//     (with EPOLLEXCLUSIVE, so a new connection wakes one loop) and all
+//     sessions share the one published corpus through the EpochCorpus.
+//
+// Valid States include: Not listening, listening (after listenTcp() or
+//                       listenUnix()), serving (after start()), and stopped.
+//
+// Anticipated Use:  main() creates one server in server mode, calls
+//                   listenTcp()/listenUnix() and start(), waits for a signal,
+//                   and calls stop().
+//
+// Class Invariants:  -A connection is only touched by the loop that accepted
+//                     it.
+//                    -Each loop uses its own corpus reader slot, its own
+//                     FastRandom, its own GameStats shard and (if logging)
+//                     its own EventLog.
+//
+// Assumptions:
+//      -The EpochCorpus outlives the server.
+//      -Linux 4.5 or newer (for EPOLLEXCLUSIVE).
+//
+// Dependencies: GameSession, GameChannel, GameTask, EpochCorpus, FastRandom,
+//               EventLog, GameStats
+//
+
+class GameServer {
+private:
+    struct Connection {
+        int fd;
+        std::string input;
+        bool wantsRead;  //False while too much output is still unsent
+        bool wantsWrite;
+        GameChannel channel;
+        GameSession session;
+        GameTask game; //Declared last so the coroutine is destroyed first
+        Connection(int fd, EpochCorpus&, int readerSlot, FastRandom&,
+                   EventLog * events, StatsShard * stats);
+    };
+    typedef std::unordered_map<int, std::unique_ptr<Connection> > ConnTable;
+
+    EpochCorpus& corpusEpochs;
+    uint64_t seed;
+    int listenFd;
+    int wakeFd;
+    std::string unixPath;
+    std::string eventLogDirectory;
+    std::atomic<bool> keepServing;
+    std::vector<std::thread> loops;
+    GameStats stats;
+
+    void runLoop(unsigned int loopIndex);
+    struct LoopState { //What every session on one loop shares
+        int readerSlot;
+        FastRandom * rng;
+        EventLog * events;
+        StatsShard * stats;
+    };
+    void acceptConnections(int epollFd, ConnTable&, const LoopState&);
+    bool readFrom(Connection&);
+    bool pushLines(Connection&);
+    bool writeTo(int epollFd, Connection&);
+    void closeConnection(int epollFd, ConnTable&, int fd);
+
+    GameServer(const GameServer&);
+    GameServer& operator=(const GameServer&);
+public:
+    GameServer(EpochCorpus&, uint64_t seed);
+    //Description: Constructs a server that is not listening yet
+    //Preconditions: None
+    //Postconditions: Server is not listening
+
+    ~GameServer(void);
+    //Description: Stops the server and closes every socket
+
+    bool listenTcp(int port);
+    //Description: Listens on the TCP port on every interface
+    //Preconditions: Server is not already listening
+    //Postconditions: Returns false (and prints why) if the socket could not
+    //                be set up
+
+    bool listenUnix(const std::string& path);
+    //Description: Listens on a Unix-domain socket at path, replacing any stale
+    //             socket file left behind there
+    //Preconditions: Server is not already listening
+    //Postconditions: Returns false (and prints why) if the socket could not
+    //                be set up
+
+    void setEventLogDirectory(const std::string& directory);
+    //Description: Has every event loop log its rounds to its own EventLog
+    //             in the directory
+    //Preconditions: Server is not serving yet
+    //Postconditions: None
+
+    void start(unsigned int threads = 0u);
+    //Description: Starts 'threads' event loops (0 meaning one per hardware
+    //             thread) and returns immediately
+    //Preconditions: Server is listening and not already serving
+    //Postconditions: Connections are accepted until stop() is called
+
+    const GameStats& getStats(void) const;
+    //Description: Returns the guess counts of every game served so far
+    //Preconditions: None
+    //Postconditions: None, this method is const
+
+    void stop(void);
+    //Description: Stops every loop, closes every connection and waits for the
+    //             loop threads to finish
+    //Preconditions: None
+    //Postconditions: Server is stopped
+};
+
+#endif /* GameServer_h */
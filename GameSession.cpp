@@ -0,0 +1,300 @@
+// Author: Forrest Miller
+// Filename: GameSession.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "GameSession.h"
+#include "Instrumentation.h"
+#include "AllocationTracker.h"
+#include <cctype>
+#include <optional>
+#include <stdlib.h>
+#include <string.h>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the GameSession
+//          class. play() is the only coroutine; everything it writes goes
+//          through small helpers that append to the channel's output. Fixed
+//          text is appended as static fragments, so each round only copies
+//          the puzzle and the numbers.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const float SESSION_ONE_HUNDRED_PERCENT = 100.0;
+const float SESSION_FIFTY_PERCENT = 50.0;
+const int QUIT_WORD_LENGTH = 0;
+//Rendered once, then handed to every game without being copied
+const std::string LENGTH_PROMPT = "Enter number of letters for guessWord [" +
+    std::to_string(MIN_PUZZLE_WORD_LENGTH) + " - " +
+    std::to_string(MAX_PUZZLE_WORD_LENGTH) + ", or 0 to quit]:\n";
+const std::string OUT_OF_RANGE_TAIL = " which is outside the range " +
+    std::to_string(MIN_PUZZLE_WORD_LENGTH) + " to " +
+    std::to_string(MAX_PUZZLE_WORD_LENGTH) + "\nPlease try again\n";
+
+static float percentOf(int correct, int total) {
+    if (total <= 0) {
+        return 0.0;
+    }
+    return ((float) correct / (float) total) * SESSION_ONE_HUNDRED_PERCENT;
+}
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+GameSession::GameSession(EpochCorpus& epochs, int slot, FastRandom& random,
+                         PuzzlePool * puzzlePool, EventLog * eventLog,
+                         StatsShard * statsShard)
+: corpusEpochs(epochs), rng(random) {
+    this->readerSlot = slot;
+    this->pool = puzzlePool;
+    this->events = eventLog;
+    this->stats = statsShard;
+    this->correctGuesses = 0;
+    this->incorrectGuesses = 0;
+    this->roundsPlayed = 0;
+    this->traceSession = NOT_TRACED;
+    this->roundTimings = nullptr;
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+GameTask GameSession::play(GameChannel& channel) {
+    this->traceSession = Tracer::sampleSession();
+    OutputBuffer& out = channel.getOutput();
+    out.appendLiteral("Welcome to the Sequence Enumeration Guessing Game!\n"
+    "Would you like to review the rules before the game starts? [y/n] ");
+    std::optional<std::string> answer = co_await channel.nextLine();
+    if (answer && !answer->empty() && ('y' == (*answer)[0] ||
+                                       'Y' == (*answer)[0])) {
+        appendRules(out);
+    }
+    out.appendLiteral("\n");
+    bool inputLeft = answer.has_value();
+    while (inputLeft) {
+        uint32_t round = (uint32_t) this->roundsPlayed + 1u;
+        appendLengthPrompt(out);
+        TraceSpan lengthWait(this->traceSession, round, TRACE_INPUT_WAIT);
+        std::optional<std::string> token = co_await channel.nextToken();
+        lengthWait.end();
+        if (!token) {
+            break;
+        }
+        if (!std::isdigit((unsigned char) (*token)[0])) {
+            out.appendLiteral("\nError, Invalid Input. You entered: ");
+            out.append(*token);
+            out.appendLiteral("\n\nPlease try again\n");
+            continue;
+        }
+        int length = (int) strtol(token->c_str(), nullptr, 10);
+        if (QUIT_WORD_LENGTH == length) {
+            break;
+        }
+        TraceSpan roundSpan(this->traceSession, round, TRACE_ROUND);
+        std::chrono::steady_clock::time_point roundStarted;
+        if (nullptr != this->roundTimings) {
+            roundStarted = std::chrono::steady_clock::now();
+        }
+        std::unique_ptr<Puzzle> puzzle = drawPuzzle(length);
+        if (!puzzle) {
+            out.appendLiteral("\nError, the number you entered is ");
+            out.appendInt(length);
+            out.appendStatic(OUT_OF_RANGE_TAIL);
+            continue;
+        }
+        //The puzzle may be shared with other sessions, so everything this
+        //round changes (like revealing the answer) happens in its own view
+        PuzzleView word(*puzzle);
+        int guessesThisRound = 0;
+        int outcome = ROUND_LOST;
+        std::chrono::steady_clock::time_point shownAt =
+        std::chrono::steady_clock::now();
+        while (true) {
+            TraceSpan render(this->traceSession, round, TRACE_RENDER);
+            appendGuessPrompt(word, out);
+            render.end();
+            TraceSpan guessWait(this->traceSession, round, TRACE_INPUT_WAIT);
+            std::optional<std::string> guess = co_await channel.nextToken();
+            guessWait.end();
+            if (!guess) {
+                inputLeft = false; //Out of input, end the game
+                outcome = ROUND_ABANDONED;
+                out.appendLiteral("\n");
+                break;
+            }
+            TraceSpan grade(this->traceSession, round, TRACE_GRADE);
+            bool correct = word.guessWord(*guess);
+            grade.end();
+            if (nullptr != this->stats) {
+                this->stats->countGuess(puzzle->getWordLength(),
+                                        puzzle->getTransform(), correct);
+            }
+            if (correct) {
+                this->correctGuesses++;
+                guessesThisRound++;
+                outcome = ROUND_WON;
+                out.appendLiteral("\nCORRECT! Way to go!\n");
+                break;
+            }
+            this->incorrectGuesses++;
+            guessesThisRound++;
+            out.appendLiteral("\nWrong! Try again. You entered: ");
+            out.append(*guess);
+            if (guessesThisRound >= MAX_GUESSES) {
+                out.appendLiteral("\nUh-oh! You used up all your guesses...\n"
+                "The word you were trying to guess was: ");
+                word.toggleEncryptionActivation(); //Show the original word
+                out.append(word.emitWord()); //Copied, the puzzle goes away
+                out.append('\n');
+                break;
+            }
+            out.appendLiteral("\nPlease try again. Guesses remaining: ");
+            out.appendInt(MAX_GUESSES - guessesThisRound);
+            out.append('\n');
+        }
+        logRound(*puzzle, guessesThisRound, outcome, shownAt);
+        if (nullptr != this->roundTimings) {
+            RoundTiming timing = {length, guessesThisRound, outcome,
+                std::chrono::steady_clock::now() - roundStarted};
+            this->roundTimings->push_back(timing);
+        }
+        if (inputLeft) {
+            appendScore(out);
+        }
+    }
+    appendFarewell(out);
+    channel.flush();
+}
+
+void GameSession::recordRoundTimings(std::vector<RoundTiming> * timings) {
+    this->roundTimings = timings;
+}
+
+int GameSession::getCorrectGuesses(void) const {
+    return this->correctGuesses;
+}
+
+int GameSession::getIncorrectGuesses(void) const {
+    return this->incorrectGuesses;
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+
+//Takes a fresh puzzle from the pool if there is one, and otherwise copies one
+//out of the current corpus. Returns null if the length has no words.
+std::unique_ptr<Puzzle> GameSession::drawPuzzle(int length) {
+    ProbeTimer timer(PROBE_SELECT_WORD);
+    AllocationScope scope(ALLOC_ROUND);
+    std::unique_ptr<Puzzle> puzzle;
+    if (length < MIN_PUZZLE_WORD_LENGTH || length > MAX_PUZZLE_WORD_LENGTH) {
+        return puzzle;
+    }
+    uint32_t round = (uint32_t) this->roundsPlayed + 1u;
+    if (nullptr != this->pool) { //The pool's puzzles are already generated
+        TraceSpan generate(this->traceSession, round, TRACE_GENERATE);
+        puzzle.reset(this->pool->takePuzzle(length));
+    }
+    if (!puzzle) {
+        this->corpusEpochs.waitForCorpus(); //Only waits with --fast-start
+        EpochCorpus::ReadGuard corpus(this->corpusEpochs, this->readerSlot);
+        if (corpus->getNumPuzzles(length) > 0) {
+            TraceSpan select(this->traceSession, round, TRACE_SELECT);
+            int index = (int) corpus->getSampler(length).draw(this->rng);
+            select.end();
+            TraceSpan generate(this->traceSession, round, TRACE_GENERATE);
+            puzzle.reset(new Puzzle(corpus->getPuzzle(length, index)));
+        }
+    }
+    return puzzle;
+}
+
+//Appends the round to the event log, if there is one. The clocks are only
+//read when there is somewhere to put the times.
+void GameSession::logRound(const Puzzle& puzzle, int guesses, int outcome,
+                           std::chrono::steady_clock::time_point shownAt) {
+    this->roundsPlayed++;
+    if (nullptr == this->events) {
+        return;
+    }
+    std::chrono::steady_clock::duration took =
+    std::chrono::steady_clock::now() - shownAt;
+    RoundEvent event;
+    memset(&event, 0, sizeof(event)); //No stray bytes in the log
+    event.finishedAtNs = (uint64_t)
+    std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::system_clock::now().time_since_epoch()).count();
+    event.durationUs = (uint32_t)
+    std::chrono::duration_cast<std::chrono::microseconds>(took).count();
+    event.wordIndex = (uint32_t) puzzle.getWordIndex();
+    event.wordLength = (uint8_t) puzzle.getWordLength();
+    event.transform = (uint8_t) puzzle.getTransform();
+    event.guesses = (uint8_t) guesses;
+    event.outcome = (uint8_t) outcome;
+    event.round = (uint32_t) this->roundsPlayed;
+    this->events->append(event);
+}
+
+void GameSession::appendRules(OutputBuffer& out) const {
+    out.appendLiteral("\n\n"
+    "Rules: The game begins by the player selecting the length of\n"
+    "a word. A word of that length is then used to generate\na SequenceEnum"
+    " variation of itself, which is then displayed\nto the player. The "
+    "player has 3 guesses to guess what the original\nword was before"
+    " it was modified by the SequenceEnum. After 3 incorrect\nguesses, "
+    "the game will let the player know what the word they have been\ntrying"
+    " to guess actually is.\n");
+}
+
+void GameSession::appendLengthPrompt(OutputBuffer& out) const {
+    out.appendStatic(LENGTH_PROMPT);
+}
+
+void GameSession::appendGuessPrompt(const PuzzleView& word,
+                                    OutputBuffer& out) const {
+    AllocationScope scope(ALLOC_ROUND);
+    out.appendLiteral("Can you guess what this word was before it was\n"
+    "modified by the SequenceEnum?\nModified word to guess: ");
+    out.append(word.emitWord());
+    out.appendLiteral("\nEnter your guess: ");
+}
+
+void GameSession::appendScore(OutputBuffer& out) const {
+    int total = this->correctGuesses + this->incorrectGuesses;
+    out.appendLiteral("\nScore so far:\nCorrect: ");
+    out.appendInt(this->correctGuesses);
+    out.appendLiteral("\nIncorrect: ");
+    out.appendInt(this->incorrectGuesses);
+    out.appendLiteral("\nTotal Guesses: ");
+    out.appendInt(total);
+    out.appendLiteral("\nGuess Percentage: ");
+    out.appendFloat(percentOf(this->correctGuesses, total));
+    out.appendLiteral("%\n");
+}
+
+void GameSession::appendFarewell(OutputBuffer& out) const {
+    int total = this->correctGuesses + this->incorrectGuesses;
+    float percentCorrect = percentOf(this->correctGuesses, total);
+    out.appendLiteral("Thanks for playing. Your final score was: \n"
+    "Correct Guesses: ");
+    out.appendInt(this->correctGuesses);
+    out.appendLiteral("\nIncorrect Guesses: ");
+    out.appendInt(this->incorrectGuesses);
+    out.appendLiteral("\nTotal Guesses: ");
+    out.appendInt(total);
+    out.appendLiteral("\nGuess Percentage: ");
+    out.appendFloat(percentCorrect);
+    out.appendLiteral("%\n");
+    if (percentCorrect > SESSION_FIFTY_PERCENT) {
+        out.appendLiteral("Nice Work!\nGoodbye!\n");
+    }
+    else {
+        out.appendLiteral("Better luck next time!\nGoodbye!\n");
+    }
+}
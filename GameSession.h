@@ -0,0 +1,125 @@
+// Author: Forrest Miller
+// Filename: GameSession.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef GameSession_h
+#define GameSession_h
+
+#include "Puzzle.h"
+#include "PuzzleView.h"
+#include "EpochCorpus.h"
+#include "PuzzlePool.h"
+#include "FastRandom.h"
+#include "GameChannel.h"
+#include "GameTask.h"
+#include "OutputBuffer.h"
+#include "EventLog.h"
+#include "GameStats.h"
+#include "Tracer.h"
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+//
+// Class Overview:
+//     This class is one player's game. The rules are written once, as the
+//     coroutine play(), which co_awaits each line of input from a GameChannel
+//     instead of blocking on std::cin. The same code therefore runs the
+//     interactive terminal game (where input never has to wait), a scripted
+//     game, and thousands of server games on one thread (where each game
+//     sleeps in its own coroutine frame until its player sends a line).
+//     The rules and wording are the terminal game's: an optional look at the
+//     rules, then rounds of picking a word length and getting MAX_GUESSES
+//     tries at the puzzle, with the running score shown after every round.
+//     Entering 0 for the length (or running out of input) ends the game.
+//
+// Valid States include: Not yet playing, playing, and finished (see the
+//                       GameTask returned by play()).
+//
+// Anticipated Use:  One per player. Call play() once and keep the returned
+//                   GameTask, the session and the channel together.
+//
+// Class Invariants:  -A puzzle drawn from the corpus is copied into the game,
+//                     so a game never pins a corpus while waiting for input.
+//                    -With an EventLog, every round that shows a puzzle is
+//                     logged once, including one cut short by the player
+//                     leaving.
+//
+// Assumptions:
+//      -The EpochCorpus, reader slot, generator, pool, event log and stats
+//       shard (if any) outlive the session and belong to the thread that
+//       resumes the game.
+//
+// Dependencies: Puzzle, PuzzleView, EpochCorpus, PuzzlePool, FastRandom,
+//               GameChannel, GameTask, OutputBuffer, EventLog, GameStats,
+//               Tracer
+//
+
+const int MAX_GUESSES = 3;
+const int MIN_PUZZLE_WORD_LENGTH = 3;
+const int MAX_PUZZLE_WORD_LENGTH = 12;
+
+//How long one round took, from reading its word length to its outcome
+//(including any wait for the player, which a replayed game never has)
+struct RoundTiming {
+    int wordLength;
+    int guesses;
+    int outcome;            //ROUND_WON, ROUND_LOST or ROUND_ABANDONED
+    std::chrono::steady_clock::duration took;
+};
+
+class GameSession {
+private:
+    EpochCorpus& corpusEpochs;
+    int readerSlot;
+    FastRandom& rng;
+    PuzzlePool * pool;
+    EventLog * events;
+    StatsShard * stats;
+    int correctGuesses;
+    int incorrectGuesses;
+    int roundsPlayed;
+    uint32_t traceSession; //NOT_TRACED unless sampled by the Tracer
+    std::vector<RoundTiming> * roundTimings;
+
+    std::unique_ptr<Puzzle> drawPuzzle(int length);
+    void logRound(const Puzzle&, int guesses, int outcome,
+                  std::chrono::steady_clock::time_point shownAt);
+    void appendRules(OutputBuffer& out) const;
+    void appendLengthPrompt(OutputBuffer& out) const;
+    void appendGuessPrompt(const PuzzleView&, OutputBuffer& out) const;
+    void appendScore(OutputBuffer& out) const;
+    void appendFarewell(OutputBuffer& out) const;
+public:
+    GameSession(EpochCorpus&, int readerSlot, FastRandom& rng,
+                PuzzlePool * pool = nullptr, EventLog * events = nullptr,
+                StatsShard * stats = nullptr);
+    //Description: Constructs a session that draws puzzles from the pool when
+    //             it has one ready, and from the corpus otherwise, logs every
+    //             round to the event log and counts every guess in the stats
+    //             shard, if it is given them
+    //Preconditions: readerSlot must be registered with the EpochCorpus. The
+    //               pool (a single consumer queue) must not be shared with
+    //               other sessions.
+    //Postconditions: Score is zero
+
+    GameTask play(GameChannel& channel);
+    //Description: Plays the whole game over the channel. Runs until it needs
+    //             input the channel doesn't have, then waits to be resumed by
+    //             the channel.
+    //Preconditions: Called once; the channel outlives the returned task
+    //Postconditions: Task is done once the player quits or input runs out
+
+    void recordRoundTimings(std::vector<RoundTiming> * timings);
+    //Description: Appends the timing of every round played from now on to
+    //             the list (or stops, if it is null)
+    //Preconditions: The list outlives the game
+
+    int getCorrectGuesses(void) const;
+    int getIncorrectGuesses(void) const;
+    //Description: Return the score so far
+};
+
+#endif /* GameSession_h */
@@ -0,0 +1,142 @@
+// Author: Forrest Miller
+// Filename: GameStats.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "GameStats.h"
+#include <stdio.h>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the GameStats and
+//          StatsShard classes. Every count is an atomic read and written with
+//          relaxed ordering: the owner's increment compiles to an ordinary
+//          add, and a reader adding up the shards never sees a torn count.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const int INCORRECT_COUNT = 0;
+const int CORRECT_COUNT = 1;
+const double STATS_ONE_HUNDRED_PERCENT = 100.0;
+const int STATS_LABEL_BYTES = 32;
+const int STATS_ROW_BYTES = 96;
+
+static void clearCounts(GuessCounts& counts) {
+    counts.correct = 0u;
+    counts.incorrect = 0u;
+}
+
+//Prints one row, skipping rows with no guesses unless told not to
+static void reportRow(const char * label, const GuessCounts& counts,
+                      bool always, std::ostream& out) {
+    uint64_t total = counts.correct + counts.incorrect;
+    if (0u == total && !always) {
+        return;
+    }
+    double percent = (0u == total) ? 0.0 :
+    STATS_ONE_HUNDRED_PERCENT * (double) counts.correct / (double) total;
+    char row[STATS_ROW_BYTES];
+    snprintf(row, sizeof(row), "%-14s %10llu %10llu %10llu %8.2f\n", label,
+             (unsigned long long) counts.correct,
+             (unsigned long long) counts.incorrect,
+             (unsigned long long) total, percent);
+    out << row;
+}
+
+//--------------------------------------------------------------------
+//  Constructors
+//--------------------------------------------------------------------
+StatsShard::StatsShard(void) {
+    for (unsigned long len = 0ul; len < MAX_DICTIONARY_WORD_LENGTH; len++) {
+        for (int variant = 0; variant < SEQ_ENUM_VARIANTS; variant++) {
+            this->counts[len][variant][INCORRECT_COUNT].store(0u);
+            this->counts[len][variant][CORRECT_COUNT].store(0u);
+        }
+    }
+    this->claimed.store(false);
+}
+
+GameStats::GameStats(void) {
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+void StatsShard::countGuess(unsigned long wordLength, int transform,
+                            bool correct) {
+    if (wordLength >= MAX_DICTIONARY_WORD_LENGTH || transform < 0 ||
+        transform >= SEQ_ENUM_VARIANTS) {
+        return;
+    }
+    //Only this shard's thread writes the count, so no read-modify-write
+    std::atomic<uint64_t>& count =
+    this->counts[wordLength][transform][correct ? CORRECT_COUNT :
+                                                  INCORRECT_COUNT];
+    count.store(count.load(std::memory_order_relaxed) + 1u,
+                std::memory_order_relaxed);
+}
+
+StatsShard * GameStats::claimShard(void) {
+    for (int i = 0; i < MAX_STATS_SHARDS; i++) {
+        bool unclaimed = false;
+        if (this->shards[i].claimed.compare_exchange_strong(unclaimed, true)) {
+            return &this->shards[i];
+        }
+    }
+    return nullptr;
+}
+
+void GameStats::releaseShard(StatsShard * shard) {
+    if (nullptr != shard) {
+        shard->claimed.store(false);
+    }
+}
+
+void GameStats::snapshot(GuessStats& stats) const {
+    for (unsigned long len = 0ul; len < MAX_DICTIONARY_WORD_LENGTH; len++) {
+        clearCounts(stats.byLength[len]);
+    }
+    for (int variant = 0; variant < SEQ_ENUM_VARIANTS; variant++) {
+        clearCounts(stats.byTransform[variant]);
+    }
+    clearCounts(stats.total);
+    for (const StatsShard& shard : this->shards) {
+        for (unsigned long len = 0ul; len < MAX_DICTIONARY_WORD_LENGTH;
+             len++) {
+            for (int variant = 0; variant < SEQ_ENUM_VARIANTS; variant++) {
+                uint64_t correct = shard.counts[len][variant][CORRECT_COUNT]
+                                   .load(std::memory_order_relaxed);
+                uint64_t incorrect = shard.counts[len][variant]
+                                     [INCORRECT_COUNT]
+                                     .load(std::memory_order_relaxed);
+                stats.byLength[len].correct += correct;
+                stats.byLength[len].incorrect += incorrect;
+                stats.byTransform[variant].correct += correct;
+                stats.byTransform[variant].incorrect += incorrect;
+                stats.total.correct += correct;
+                stats.total.incorrect += incorrect;
+            }
+        }
+    }
+}
+
+void GameStats::report(std::ostream& out) const {
+    GuessStats stats;
+    snapshot(stats);
+    out << "                  Correct  Incorrect      Total  Percent\n";
+    reportRow("All players", stats.total, true, out);
+    char label[STATS_LABEL_BYTES];
+    for (unsigned long len = 0ul; len < MAX_DICTIONARY_WORD_LENGTH; len++) {
+        snprintf(label, sizeof(label), "%lu letters", len);
+        reportRow(label, stats.byLength[len], false, out);
+    }
+    for (int variant = 0; variant < SEQ_ENUM_VARIANTS; variant++) {
+        reportRow(PuzzleFactory::variantName(variant),
+                  stats.byTransform[variant], false, out);
+    }
+    out.flush();
+}
@@ -0,0 +1,110 @@
+// Author: Forrest Miller
+// Filename: GameStats.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef GameStats_h
+#define GameStats_h
+
+#include "Dictionary.h"
+#include "PuzzleFactory.h"
+#include <atomic>
+#include <ostream>
+#include <stdint.h>
+
+//
+// Class Overview:
+//     This class counts correct and incorrect guesses across every game being
+//     played at once, by word length and by transform. Counting a guess must
+//     not slow the game down as threads are added, so there is no shared
+//     counter: each thread that plays games claims a StatsShard of its own
+//     and only ever writes to that. Since a shard has one writer, counting is
+//     a plain load, add and store (no locked instruction), and each shard is
+//     followed by a cache line of padding so two threads never write to the
+//     same line. The shards are only added up when someone asks for the
+//     numbers, which is rare next to counting guesses.
+//
+// Valid States include: Any number of shards claimed, each holding the counts
+//                       of the games played on it.
+//
+// Anticipated Use:  One per server or load test. Each event loop or worker
+//                   calls claimShard() once and hands the shard to its
+//                   sessions; the owner calls snapshot() or report() whenever
+//                   it wants the totals.
+//
+// Class Invariants:  -A shard is written only by the thread that claimed it.
+//                    -Counts are never lost: a released shard keeps its
+//                     counts and the next thread to claim it adds to them.
+//
+// Assumptions:
+//      -At most MAX_STATS_SHARDS threads count at once.
+//
+// Dependencies: Dictionary, PuzzleFactory
+//
+
+const int MAX_STATS_SHARDS = 64;
+const int STATS_SHARD_PADDING = 64; //One cache line
+
+//The counts a snapshot adds up, the same numbers the farewell shows
+struct GuessCounts {
+    uint64_t correct;
+    uint64_t incorrect;
+};
+
+struct GuessStats {
+    GuessCounts byLength[MAX_DICTIONARY_WORD_LENGTH];
+    GuessCounts byTransform[SEQ_ENUM_VARIANTS];
+    GuessCounts total;
+};
+
+class StatsShard {
+private:
+    std::atomic<uint64_t> counts[MAX_DICTIONARY_WORD_LENGTH]
+                                [SEQ_ENUM_VARIANTS][2]; //Incorrect, correct
+    std::atomic<bool> claimed;
+    char padding[STATS_SHARD_PADDING];
+
+    friend class GameStats;
+public:
+    StatsShard(void);
+    //Description: Constructs an unclaimed shard with every count at zero
+
+    void countGuess(unsigned long wordLength, int transform, bool correct);
+    //Description: Counts one guess at a puzzle
+    //Preconditions: Called only by the thread that claimed the shard
+    //Postconditions: Guesses at impossible lengths or transforms are ignored
+};
+
+class GameStats {
+private:
+    StatsShard shards[MAX_STATS_SHARDS];
+
+    GameStats(const GameStats&);
+    GameStats& operator=(const GameStats&);
+public:
+    GameStats(void);
+    //Description: Constructs the statistics with every count at zero
+
+    StatsShard * claimShard(void);
+    //Description: Claims a shard for the calling thread
+    //Preconditions: None
+    //Postconditions: Returns nullptr if every shard is taken
+
+    void releaseShard(StatsShard * shard);
+    //Description: Releases a shard (its counts stay in the totals)
+    //Preconditions: The shard came from claimShard() and no session still
+    //               counts into it
+    //Postconditions: The shard can be claimed again
+
+    void snapshot(GuessStats& stats) const;
+    //Description: Adds up every shard into stats. Counts made while this
+    //             runs may or may not be included.
+    //Preconditions: None
+    //Postconditions: None, this method is const
+
+    void report(std::ostream& out) const;
+    //Description: Prints the correct, incorrect and total guesses and the
+    //             guess percentage, over all and by length and by transform
+};
+
+#endif /* GameStats_h */
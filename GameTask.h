@@ -0,0 +1,71 @@
+// Author: Forrest Miller
+// Filename: GameTask.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef GameTask_h
+#define GameTask_h
+
+#include <coroutine>
+#include <exception>
+
+//
+// Class Overview:
+//     This class is the return type of the game's coroutines (see
+//     GameSession::play()). It owns the coroutine frame: the coroutine starts
+//     running as soon as it is called, runs until it first waits for input
+//     that isn't there yet, and is resumed by the GameChannel it is waiting
+//     on. When it finishes it stays suspended so its owner can see that it is
+//     done, and the frame is freed when the GameTask is destroyed.
+//
+// Valid States include: Running (waiting for input), done, or empty (after
+//                       being moved from).
+//
+// Anticipated Use:  Held next to the channel and session it plays, for as
+//                   long as the game lasts.
+//
+// Class Invariants:  -At most one GameTask owns a coroutine frame.
+//
+// Assumptions:
+//      -The game's coroutines do not throw.
+//
+// Dependencies: None
+//
+
+class GameTask {
+public:
+    struct promise_type {
+        GameTask get_return_object(void) {
+            return GameTask(
+                std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+        std::suspend_never initial_suspend(void) noexcept { return {}; }
+        std::suspend_always final_suspend(void) noexcept { return {}; }
+        void return_void(void) {}
+        void unhandled_exception(void) { std::terminate(); }
+    };
+
+    GameTask(GameTask&& other) noexcept : handle(other.handle) {
+        other.handle = nullptr;
+    }
+
+    ~GameTask(void) {
+        if (this->handle) {
+            this->handle.destroy();
+        }
+    }
+
+    bool isDone(void) const {
+    //Description: Returns true once the game has finished (or if empty)
+        return !this->handle || this->handle.done();
+    }
+
+private:
+    std::coroutine_handle<promise_type> handle;
+
+    explicit GameTask(std::coroutine_handle<promise_type> h) : handle(h) {}
+    GameTask(const GameTask&);
+    GameTask& operator=(const GameTask&);
+};
+
+#endif /* GameTask_h */
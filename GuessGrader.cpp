@@ -0,0 +1,120 @@
+// Author: Forrest Miller
+// Filename: GuessGrader.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "GuessGrader.h"
+#include "AllocationTracker.h"
+#include <string.h>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the GuessGrader
+//          class. Records are parsed in place, so grading a guess copies
+//          nothing but the short lowercase key the dictionary looks up.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const char PUZZLE_ID_SEPARATOR = ':';
+const size_t MAX_ID_DIGITS = 9u; //Keeps the number inside an int
+const double SECONDS_PER_MINUTE = 60.0;
+static const char * const GRADE_NAMES[MAX_RECORD_OUTCOMES] = {
+    "correct", "wrong_word", "non_word", "bad_record"};
+
+//Reads the decimal number at text[position...], advancing position past it.
+//Returns false if there are no digits. Digits past MAX_ID_DIGITS are left
+//unread, which makes the record bad.
+static bool readNumber(const char * text, size_t length, size_t& position,
+                       int& number) {
+    size_t start = position;
+    number = 0;
+    while (position < length && text[position] >= '0' &&
+           text[position] <= '9' && position - start < MAX_ID_DIGITS) {
+        number = number * 10 + (text[position] - '0');
+        position++;
+    }
+    return position > start;
+}
+
+static bool isBlank(char c) {
+    return ' ' == c || '\t' == c;
+}
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+GuessGrader::GuessGrader(const Corpus& puzzles, const Dictionary& dict)
+: corpus(puzzles), dictionary(dict) {
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+int GuessGrader::appendRecord(const char * record, size_t length,
+                              OutputBuffer& out) const {
+    AllocationScope scope(ALLOC_GRADING);
+    int result = grade(record, length);
+    out.append(record, length);
+    out.append('\t');
+    out.append(GRADE_NAMES[result], strlen(GRADE_NAMES[result]));
+    out.append('\n');
+    return result;
+}
+
+void GuessGrader::report(const BatchTally& tally, double seconds,
+                         std::ostream& out) const {
+    unsigned long graded = 0ul;
+    for (int i = 0; i < MAX_RECORD_OUTCOMES; i++) {
+        graded += tally.outcomes[i];
+    }
+    out << "Graded " << graded << " guesses in " << seconds << " seconds: ";
+    for (int i = 0; i < MAX_RECORD_OUTCOMES; i++) {
+        out << tally.outcomes[i] << " " << GRADE_NAMES[i]
+        << ((i + 1 < MAX_RECORD_OUTCOMES) ? ", " : "");
+    }
+    if (seconds > 0.0) {
+        out << " (" << (double) graded / seconds * SECONDS_PER_MINUTE
+        << " records/minute)";
+    }
+    out << std::endl;
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+int GuessGrader::grade(const char * record, size_t length) const {
+    size_t position = 0u;
+    int wordLength;
+    int index;
+    if (!readNumber(record, length, position, wordLength) ||
+        position >= length || PUZZLE_ID_SEPARATOR != record[position++] ||
+        !readNumber(record, length, position, index) ||
+        wordLength >= (int) MAX_DICTIONARY_WORD_LENGTH ||
+        index >= this->corpus.getNumPuzzles(wordLength)) {
+        return GUESS_BAD_RECORD;
+    }
+    if (position < length && !isBlank(record[position])) {
+        return GUESS_BAD_RECORD; //Something stuck to the puzzle id
+    }
+    while (position < length && isBlank(record[position])) {
+        position++;
+    }
+    size_t end = length;
+    while (end > position && isBlank(record[end - 1u])) {
+        end--;
+    }
+    const char * guess = record + position;
+    size_t guessLength = end - position;
+    if (this->corpus.getPuzzle(wordLength, index).guessWord(guess,
+                                                            guessLength)) {
+        return GUESS_CORRECT;
+    }
+    if (this->dictionary.containsWord(guess, guessLength)) {
+        return GUESS_WRONG_WORD;
+    }
+    return GUESS_NON_WORD;
+}
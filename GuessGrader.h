@@ -0,0 +1,72 @@
+// Author: Forrest Miller
+// Filename: GuessGrader.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef GuessGrader_h
+#define GuessGrader_h
+
+#include "RecordProcessor.h"
+#include "Corpus.h"
+#include "Dictionary.h"
+
+//
+// Class Overview:
+//     This class grades logged guesses in bulk, for replaying player logs
+//     through analytics. Each record names a puzzle and a guess,
+//        LENGTH:INDEX<TAB>guess
+//     where LENGTH:INDEX is the puzzle's word length and its index within
+//     that length (see Puzzle::getWordIndex()); any run of spaces or tabs may
+//     separate the two. The guess is checked against the puzzle's original
+//     word without regard to case and, if it is wrong, looked up in the
+//     dictionary, giving one of:
+//        correct     the puzzle's word
+//        wrong_word  a real word, but not the puzzle's
+//        non_word    not a word the dictionary knows
+//        bad_record  no such puzzle, or no puzzle id
+//     which is appended to the record as a third column.
+//
+// Valid States include: The class holds only references to its corpus and
+//                       dictionary.
+//
+// Anticipated Use:  Run from main() with --grade, usually through a
+//                   RecordPipeline so records are graded on every core.
+//
+// Class Invariants:  None
+//
+// Assumptions:
+//      -The corpus and dictionary outlive the grader and are not changed
+//       while it runs (the caller keeps the corpus pinned).
+//
+// Dependencies: RecordProcessor, Corpus, Puzzle, Dictionary
+//
+
+const int GUESS_CORRECT = 0; //Outcomes counted in a BatchTally
+const int GUESS_WRONG_WORD = 1;
+const int GUESS_NON_WORD = 2;
+const int GUESS_BAD_RECORD = 3;
+
+class GuessGrader : public RecordProcessor {
+private:
+    const Corpus& corpus;
+    const Dictionary& dictionary;
+
+    int grade(const char * record, size_t length) const;
+public:
+    GuessGrader(const Corpus&, const Dictionary&);
+    //Description: Constructs a grader for the corpus's puzzles
+    //Preconditions: None
+    //Postconditions: None
+
+    int appendRecord(const char * record, size_t length,
+                     OutputBuffer& out) const override;
+    //Description: Grades one record and appends it with its grade
+    //Preconditions: None
+    //Postconditions: Returns one of the GUESS_ outcomes
+
+    void report(const BatchTally& tally, double seconds,
+                std::ostream& out) const override;
+    //Description: Prints how many guesses had each grade and how fast
+};
+
+#endif /* GuessGrader_h */
@@ -0,0 +1,260 @@
+// Author: Forrest Miller
+// Filename: Instrumentation.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "Instrumentation.h"
+#include <atomic>
+#include <mutex>
+#include <stdio.h>
+#include <string.h>
+#include <vector>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the
+//          LatencyHistogram and Instrumentation classes. Each thread's
+//          histograms are allocated the first time it records and kept for
+//          the life of the process, so a snapshot still sees the calls of
+//          threads that have finished. The counts are atomics written with
+//          relaxed ordering by their one thread, so recording never uses a
+//          locked instruction and a snapshot never reads a torn count.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const int HIGHEST_BIT = 63;
+const double PROBE_ONE_HUNDRED_PERCENT = 100.0;
+const double NANOS_PER_MICROSECOND = 1000.0;
+const double DUMPED_PERCENTILES[] = {50.0, 90.0, 99.0, 99.9};
+const int DUMP_LINE_BYTES = 160;
+
+const char * const PROBE_NAMES[NUM_PROBES] = {"computeSeqEnum",
+    "performSeqExtract", "computeSpasEnum", "selectWord", "emitWord",
+    "guessWord"};
+
+//One thread's histograms. Only the counts are kept per bucket; the sum and
+//maximum are kept per probe.
+struct ThreadHistograms {
+    std::atomic<uint64_t> counts[NUM_PROBES][HISTOGRAM_BUCKETS];
+    std::atomic<uint64_t> sumNs[NUM_PROBES];
+    std::atomic<uint64_t> maxNs[NUM_PROBES];
+};
+
+static std::mutex registryLock; //Only taken by a thread's first record
+static std::vector<ThreadHistograms *> registry;
+thread_local ThreadHistograms * threadHistograms = nullptr;
+
+static inline void bump(std::atomic<uint64_t>& value, uint64_t by) {
+    value.store(value.load(std::memory_order_relaxed) + by,
+                std::memory_order_relaxed);
+}
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+LatencyHistogram::LatencyHistogram(void) {
+    clear();
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+
+//Values below HISTOGRAM_SUB_BUCKETS get a bucket each. Above that, the
+//value's top HISTOGRAM_SUB_BUCKET_BITS + 1 bits pick the bucket: the
+//position of the highest bit picks the group and the bits after it the step
+int LatencyHistogram::bucketFor(uint64_t ns) {
+    if (ns < (uint64_t) HISTOGRAM_SUB_BUCKETS) {
+        return (int) ns;
+    }
+    int shift = HIGHEST_BIT - __builtin_clzll(ns) - HISTOGRAM_SUB_BUCKET_BITS;
+    int step = (int) (ns >> shift) - HISTOGRAM_SUB_BUCKETS;
+    return HISTOGRAM_SUB_BUCKETS + shift * HISTOGRAM_SUB_BUCKETS + step;
+}
+
+uint64_t LatencyHistogram::bucketLowest(int bucket) {
+    if (bucket < HISTOGRAM_SUB_BUCKETS) {
+        return (uint64_t) bucket;
+    }
+    int shift = (bucket - HISTOGRAM_SUB_BUCKETS) / HISTOGRAM_SUB_BUCKETS;
+    int step = (bucket - HISTOGRAM_SUB_BUCKETS) % HISTOGRAM_SUB_BUCKETS;
+    return (uint64_t) (HISTOGRAM_SUB_BUCKETS + step) << shift;
+}
+
+uint64_t LatencyHistogram::bucketHighest(int bucket) {
+    if (bucket < HISTOGRAM_SUB_BUCKETS) {
+        return (uint64_t) bucket;
+    }
+    int shift = (bucket - HISTOGRAM_SUB_BUCKETS) / HISTOGRAM_SUB_BUCKETS;
+    return bucketLowest(bucket) + ((1ull << shift) - 1ull);
+}
+
+void LatencyHistogram::clear(void) {
+    memset(this->counts, 0, sizeof(this->counts));
+    this->total = 0u;
+    this->sumNs = 0u;
+    this->maxNs = 0u;
+}
+
+void LatencyHistogram::record(uint64_t ns) {
+    addBucket(bucketFor(ns), 1u, ns, ns);
+}
+
+void LatencyHistogram::addBucket(int bucket, uint64_t count, uint64_t sum,
+                                 uint64_t max) {
+    this->counts[bucket] += count;
+    this->total += count;
+    this->sumNs += sum;
+    if (max > this->maxNs) {
+        this->maxNs = max;
+    }
+}
+
+uint64_t LatencyHistogram::getCount(void) const {
+    return this->total;
+}
+
+uint64_t LatencyHistogram::getBucketCount(int bucket) const {
+    return this->counts[bucket];
+}
+
+uint64_t LatencyHistogram::getMaxNs(void) const {
+    return this->maxNs;
+}
+
+double LatencyHistogram::getMeanNs(void) const {
+    if (0u == this->total) {
+        return 0.0;
+    }
+    return (double) this->sumNs / (double) this->total;
+}
+
+uint64_t LatencyHistogram::percentileNs(double percent) const {
+    if (0u == this->total) {
+        return 0u;
+    }
+    //The rank'th smallest value, counting from 1
+    uint64_t rank = (uint64_t) (percent / PROBE_ONE_HUNDRED_PERCENT *
+                                (double) this->total + 0.5);
+    if (rank < 1u) {
+        rank = 1u;
+    }
+    uint64_t seen = 0u;
+    for (int bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++) {
+        seen += this->counts[bucket];
+        if (seen >= rank) {
+            uint64_t highest = bucketHighest(bucket);
+            return highest < this->maxNs ? highest : this->maxNs;
+        }
+    }
+    return this->maxNs;
+}
+
+bool Instrumentation::isEnabled(void) {
+#ifdef P4_INSTRUMENT
+    return true;
+#else
+    return false;
+#endif
+}
+
+void Instrumentation::record(int probe, uint64_t ns) {
+    ThreadHistograms * mine = threadHistograms;
+    if (nullptr == mine) {
+        mine = new ThreadHistograms(); //Zeroed
+        std::lock_guard<std::mutex> lock(registryLock);
+        registry.push_back(mine);
+        threadHistograms = mine;
+    }
+    bump(mine->counts[probe][LatencyHistogram::bucketFor(ns)], 1u);
+    bump(mine->sumNs[probe], ns);
+    if (ns > mine->maxNs[probe].load(std::memory_order_relaxed)) {
+        mine->maxNs[probe].store(ns, std::memory_order_relaxed);
+    }
+}
+
+void Instrumentation::snapshot(int probe, LatencyHistogram& histogram) {
+    histogram.clear();
+    std::lock_guard<std::mutex> lock(registryLock);
+    for (ThreadHistograms * thread : registry) {
+        uint64_t sum = thread->sumNs[probe].load(std::memory_order_relaxed);
+        uint64_t max = thread->maxNs[probe].load(std::memory_order_relaxed);
+        for (int bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++) {
+            uint64_t count = thread->counts[probe][bucket]
+                             .load(std::memory_order_relaxed);
+            if (count > 0u) {
+                histogram.addBucket(bucket, count, sum, max);
+                sum = 0u; //Each thread's sum is added only once
+            }
+        }
+    }
+}
+
+const char * Instrumentation::probeName(int probe) {
+    return PROBE_NAMES[probe];
+}
+
+void Instrumentation::dumpText(std::ostream& out) {
+    if (!isEnabled()) {
+        out << "Latency probes are off (build with -DP4_INSTRUMENT)\n";
+        out.flush();
+        return;
+    }
+    out << "Latency (us)          Calls      Mean       p50       p90"
+    "       p99     p99.9       Max\n";
+    LatencyHistogram histogram;
+    char line[DUMP_LINE_BYTES];
+    for (int probe = 0; probe < NUM_PROBES; probe++) {
+        snapshot(probe, histogram);
+        int used = snprintf(line, sizeof(line), "%-18s %9llu %9.3f",
+                            PROBE_NAMES[probe],
+                            (unsigned long long) histogram.getCount(),
+                            histogram.getMeanNs() / NANOS_PER_MICROSECOND);
+        for (double percent : DUMPED_PERCENTILES) {
+            used += snprintf(line + used, sizeof(line) - (size_t) used,
+                             " %9.3f", (double) histogram.percentileNs(percent)
+                             / NANOS_PER_MICROSECOND);
+        }
+        snprintf(line + used, sizeof(line) - (size_t) used, " %9.3f\n",
+                 (double) histogram.getMaxNs() / NANOS_PER_MICROSECOND);
+        out << line;
+    }
+    out.flush();
+}
+
+void Instrumentation::dumpJson(std::ostream& out) {
+    out << "{\"enabled\": " << (isEnabled() ? "true" : "false");
+    out << ", \"unit\": \"ns\", \"probes\": {";
+    LatencyHistogram histogram;
+    for (int probe = 0; probe < NUM_PROBES; probe++) {
+        snapshot(probe, histogram);
+        out << (0 == probe ? "\n" : ",\n") << "  \"" << PROBE_NAMES[probe];
+        out << "\": {\"count\": " << histogram.getCount();
+        out << ", \"mean\": " << histogram.getMeanNs();
+        out << ", \"p50\": " << histogram.percentileNs(50.0);
+        out << ", \"p90\": " << histogram.percentileNs(90.0);
+        out << ", \"p99\": " << histogram.percentileNs(99.0);
+        out << ", \"p99.9\": " << histogram.percentileNs(99.9);
+        out << ", \"max\": " << histogram.getMaxNs();
+        out << ", \"buckets\": ["; //[lowest, highest, count] when not empty
+        bool first = true;
+        for (int bucket = 0; bucket < HISTOGRAM_BUCKETS; bucket++) {
+            uint64_t count = histogram.getBucketCount(bucket);
+            if (0u == count) {
+                continue;
+            }
+            out << (first ? "" : ", ") << "[";
+            out << LatencyHistogram::bucketLowest(bucket) << ", ";
+            out << LatencyHistogram::bucketHighest(bucket) << ", ";
+            out << count << "]";
+            first = false;
+        }
+        out << "]}";
+    }
+    out << "\n}}\n";
+    out.flush();
+}
@@ -0,0 +1,149 @@
+// Author: Forrest Miller
+// Filename: Instrumentation.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef Instrumentation_h
+#define Instrumentation_h
+
+//#define P4_INSTRUMENT //Uncomment (or build with -DP4_INSTRUMENT) to time
+                        //the hot paths. Every file must agree on it.
+
+#include <chrono>
+#include <ostream>
+#include <stddef.h>
+#include <stdint.h>
+
+//
+// Class Overview:
+//     These classes time the game's hot paths while it runs, so we can see
+//     where time goes under real load without attaching a profiler. A
+//     ProbeTimer placed at the top of a function records how long the call
+//     took into that probe's LatencyHistogram. The histograms are HDR style:
+//     values are bucketed by their power of two and then into
+//     HISTOGRAM_SUB_BUCKETS linear steps within it, so every value from a
+//     nanosecond to hours is kept to within about 3% with a fixed 1920
+//     buckets and recording is a couple of shifts and an add. Each thread
+//     records into histograms of its own; the snapshot adds them up.
+//
+//     Instrumentation is compiled in only when P4_INSTRUMENT is defined.
+//     Otherwise ProbeTimer is an empty class and every probe compiles away.
+//
+// Valid States include: LatencyHistogram: holding any number of values.
+//                       Instrumentation has only static members.
+//
+// Anticipated Use:  Declare 'ProbeTimer timer(PROBE_...);' first thing in a
+//                   function to time it. main() dumps every probe at
+//                   shutdown with dumpText() and dumpJson().
+//
+// Class Invariants:  -A thread's histograms are written only by that thread.
+//                    -A bucket's count is the number of recorded values
+//                     between its lowest and highest value.
+//
+// Assumptions:
+//      -Each thread records at most a few hundred million values per probe
+//       per second (counts are 64 bits).
+//
+// Dependencies: None
+//
+
+const int PROBE_SEQ_ENUM = 0;      //SequenceEnum::computeSeqEnum()
+const int PROBE_SEQ_EXTRACT = 1;   //SeqExtract::performSeqExtract()
+const int PROBE_SPAS_ENUM = 2;     //SpasEnum::computeSpasEnum()
+const int PROBE_SELECT_WORD = 3;   //Drawing a puzzle for a round
+const int PROBE_EMIT_WORD = 4;     //Every emitWord()
+const int PROBE_GUESS_WORD = 5;    //Puzzle::guessWord()
+const int NUM_PROBES = 6;
+
+const int HISTOGRAM_SUB_BUCKET_BITS = 5;
+const int HISTOGRAM_SUB_BUCKETS = 1 << HISTOGRAM_SUB_BUCKET_BITS;
+const int HISTOGRAM_BUCKETS = HISTOGRAM_SUB_BUCKETS * 60; //Up to 2^64 ns
+
+class LatencyHistogram {
+private:
+    uint64_t counts[HISTOGRAM_BUCKETS];
+    uint64_t total;
+    uint64_t sumNs;
+    uint64_t maxNs;
+public:
+    LatencyHistogram(void);
+    //Description: Constructs an empty histogram
+
+    static int bucketFor(uint64_t ns);
+    //Description: Returns the bucket that holds the value
+
+    static uint64_t bucketLowest(int bucket);
+    static uint64_t bucketHighest(int bucket);
+    //Description: Return the range of values that land in the bucket
+
+    void clear(void);
+    //Description: Empties the histogram
+
+    void record(uint64_t ns);
+    //Description: Adds one value
+
+    void addBucket(int bucket, uint64_t count, uint64_t sum, uint64_t max);
+    //Description: Adds count values already bucketed, with their sum and
+    //             largest value (how snapshots merge the threads)
+
+    uint64_t getCount(void) const;
+    uint64_t getBucketCount(int bucket) const;
+    uint64_t getMaxNs(void) const;
+    double getMeanNs(void) const;
+
+    uint64_t percentileNs(double percent) const;
+    //Description: Returns the highest value of the bucket holding the given
+    //             percentile (0 to 100), or 0 if the histogram is empty
+};
+
+class Instrumentation {
+public:
+    static bool isEnabled(void);
+    //Description: Returns true if this build was compiled with P4_INSTRUMENT
+
+    static void record(int probe, uint64_t ns);
+    //Description: Records one call of the probe into this thread's histogram
+    //Preconditions: 0 <= probe < NUM_PROBES
+
+    static void snapshot(int probe, LatencyHistogram& histogram);
+    //Description: Replaces histogram with every thread's values for the
+    //             probe so far. Values recorded while this runs may or may
+    //             not be included.
+
+    static const char * probeName(int probe);
+    //Description: Returns the name the dumps use for the probe
+
+    static void dumpText(std::ostream& out);
+    //Description: Prints a line per probe with its count, mean, percentiles
+    //             and maximum in microseconds
+
+    static void dumpJson(std::ostream& out);
+    //Description: Writes every probe's summary and non-empty buckets as JSON
+};
+
+//Times the scope it is declared in, from construction to destruction
+#ifdef P4_INSTRUMENT
+class ProbeTimer {
+private:
+    int probe;
+    std::chrono::steady_clock::time_point started;
+
+    ProbeTimer(const ProbeTimer&);
+    ProbeTimer& operator=(const ProbeTimer&);
+public:
+    explicit ProbeTimer(int probeTimed)
+    : probe(probeTimed), started(std::chrono::steady_clock::now()) {}
+    ~ProbeTimer(void) {
+        Instrumentation::record(this->probe, (uint64_t)
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now() - this->started).count());
+    }
+};
+#else
+class ProbeTimer {
+public:
+    explicit ProbeTimer(int) {}
+};
+#endif
+
+#endif /* Instrumentation_h */
@@ -0,0 +1,246 @@
+// Author: Forrest Miller
+// Filename: LoadGenerator.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "LoadGenerator.h"
+#include "GameSession.h"
+#include "GameChannel.h"
+#include "GameTask.h"
+#include "EventLog.h"
+#include "GameStats.h"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <malloc.h>
+#include <memory>
+#include <thread>
+#include <vector>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the LoadGenerator
+//          class. Bots are dealt to workers round robin. Every worker keeps
+//          its own totals and latency samples, which are only merged once
+//          all the workers have been joined.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const unsigned int IDLE_SESSIONS_MEASURED = 1000u;
+const int NUM_PLAYING_STRATEGIES = 3; //Oracle, random and solver
+const double NANOS_PER_MICRO = 1000.0;
+const double PERCENTILES[] = {50.0, 90.0, 99.0, 99.9};
+const double ONE_HUNDRED_PERCENT_LOAD = 100.0;
+
+//Everything the server keeps for a player who is thinking about a prompt
+struct IdleSession {
+    GameChannel channel;
+    GameSession session;
+    GameTask game;
+    IdleSession(EpochCorpus& epochs, int slot, FastRandom& rng)
+    : session(epochs, slot, rng), game(session.play(channel)) {}
+};
+
+//Totals for one worker thread
+struct WorkerTally {
+    unsigned long rounds;
+    unsigned long guesses;
+    unsigned long correct;
+    std::vector<uint32_t> gradeLatencies;
+    WorkerTally(void) : rounds(0ul), guesses(0ul), correct(0ul) {}
+};
+
+static double percentile(const std::vector<uint32_t>& sorted, double pct) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    unsigned long rank = (unsigned long) (pct / ONE_HUNDRED_PERCENT_LOAD *
+                                          (double) (sorted.size() - 1ul));
+    return (double) sorted[rank];
+}
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+LoadGenerator::LoadGenerator(EpochCorpus& epochs, const Dictionary& dict,
+                             uint64_t generatorSeed)
+: corpusEpochs(epochs), dictionary(dict) {
+    this->seed = generatorSeed;
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+void LoadGenerator::setEventLogDirectory(const std::string& directory) {
+    this->eventLogDirectory = directory;
+}
+
+bool LoadGenerator::run(unsigned int bots, int roundsPerBot,
+                        BotStrategy strategy, unsigned int threads,
+                        std::ostream& report) {
+    if (0u == threads) {
+        threads = std::thread::hardware_concurrency();
+    }
+    threads = std::max(1u, std::min(threads, bots));
+    AnswerKey answers;
+    buildAnswerKey(answers);
+
+    //Every worker's slot and shard are claimed up front, so that a worker
+    //that couldn't get one is never started and its bots go to the others
+    GameStats stats;
+    std::vector<int> readerSlots;
+    std::vector<StatsShard *> shards;
+    while (readerSlots.size() < threads) {
+        int readerSlot = this->corpusEpochs.registerReader();
+        if (NO_READER_SLOT == readerSlot) {
+            break;
+        }
+        StatsShard * shard = stats.claimShard();
+        if (nullptr == shard) {
+            this->corpusEpochs.unregisterReader(readerSlot);
+            break;
+        }
+        readerSlots.push_back(readerSlot);
+        shards.push_back(shard);
+    }
+    if (readerSlots.empty()) {
+        std::cerr << "Load test: no corpus reader slot or stats shard is free"
+        << std::endl;
+        return false;
+    }
+    if (readerSlots.size() < threads) {
+        std::cerr << "Load test: only " << readerSlots.size() << " of "
+        << threads << " workers could get a corpus reader slot and a stats "
+        "shard (at most " << std::min(MAX_CORPUS_READERS, MAX_STATS_SHARDS)
+        << "); running on " << readerSlots.size() << std::endl;
+        threads = (unsigned int) readerSlots.size();
+    }
+
+    std::vector<WorkerTally> tallies(threads);
+    auto worker = [&](unsigned int workerIndex) {
+        WorkerTally& tally = tallies[workerIndex];
+        int readerSlot = readerSlots[workerIndex];
+        uint64_t workerSeed = this->seed + (uint64_t) workerIndex;
+        FastRandom rng(FastRandom::splitMix(workerSeed));
+        std::unique_ptr<EventLog> events;
+        if (!this->eventLogDirectory.empty()) {
+            events.reset(new EventLog(this->eventLogDirectory,
+                                      (int) workerIndex));
+            if (!events->open()) {
+                events.reset();
+            }
+        }
+        StatsShard * shard = shards[workerIndex];
+        for (unsigned int b = workerIndex; b < bots; b += threads) {
+            BotStrategy botStrategy = strategy;
+            if (BOT_MIXED == strategy) {
+                botStrategy = (BotStrategy) (b % NUM_PLAYING_STRATEGIES);
+            }
+            BotPlayer bot(botStrategy, roundsPerBot, this->dictionary, answers,
+                          rng, tally.gradeLatencies);
+            GameSession session(this->corpusEpochs, readerSlot, rng, nullptr,
+                                events.get(), shard);
+            GameTask game = session.play(bot); //Bots never make it wait
+            tally.rounds += bot.getRoundsPlayed();
+            tally.guesses += bot.getGuessesMade();
+            tally.correct += (unsigned long) session.getCorrectGuesses();
+        }
+        stats.releaseShard(shard);
+        this->corpusEpochs.unregisterReader(readerSlot);
+    };
+    std::chrono::steady_clock::time_point started =
+    std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (unsigned int t = 0u; t < threads; t++) {
+        workers.push_back(std::thread(worker, t));
+    }
+    for (std::thread& t : workers) {
+        t.join();
+    }
+    double seconds = std::chrono::duration<double>(
+                     std::chrono::steady_clock::now() - started).count();
+
+    WorkerTally total;
+    for (WorkerTally& tally : tallies) {
+        total.rounds += tally.rounds;
+        total.guesses += tally.guesses;
+        total.correct += tally.correct;
+        total.gradeLatencies.insert(total.gradeLatencies.end(),
+                                    tally.gradeLatencies.begin(),
+                                    tally.gradeLatencies.end());
+    }
+    std::sort(total.gradeLatencies.begin(), total.gradeLatencies.end());
+
+    report << "Load test: " << bots << " bots x " << roundsPerBot;
+    report << " rounds on " << threads << " threads\n";
+    report << "Elapsed seconds: " << seconds << "\n";
+    report << "Rounds: " << total.rounds << " (";
+    report << (seconds > 0.0 ? (double) total.rounds / seconds : 0.0);
+    report << " rounds/sec)\n";
+    report << "Guesses: " << total.guesses << ", rounds won: ";
+    report << total.correct << "\n";
+    report << "Guess grading latency (us):";
+    for (double pct : PERCENTILES) {
+        report << " p" << pct << "=";
+        report << percentile(total.gradeLatencies, pct) / NANOS_PER_MICRO;
+    }
+    double maxLatency = total.gradeLatencies.empty() ? 0.0 :
+    (double) total.gradeLatencies.back();
+    report << " max=" << maxLatency / NANOS_PER_MICRO << "\n";
+    report << "Memory per idle session (bytes): ";
+    report << measureIdleSessionBytes(IDLE_SESSIONS_MEASURED) << "\n";
+    report << "Guesses by word length and transform:\n";
+    stats.report(report);
+    return true;
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+
+//Lets oracle bots look puzzles up. Only the corpus as it is now is keyed; a
+//puzzle from a later corpus makes the oracle fall back to solving.
+void LoadGenerator::buildAnswerKey(AnswerKey& answers) const {
+    int readerSlot = this->corpusEpochs.registerReader();
+    if (NO_READER_SLOT == readerSlot) {
+        return;
+    }
+    {
+        EpochCorpus::ReadGuard corpus(this->corpusEpochs, readerSlot);
+        for (int len = MIN_PUZZLE_WORD_LENGTH; len <= MAX_PUZZLE_WORD_LENGTH;
+             len++) {
+            for (int i = 0; i < corpus->getNumPuzzles(len); i++) {
+                const Puzzle& puzzle = corpus->getPuzzle(len, i);
+                answers.emplace(std::to_string(len) + ":" +
+                                puzzle.emitWord(true),
+                                puzzle.emitWord(false));
+            }
+        }
+    }
+    this->corpusEpochs.unregisterReader(readerSlot);
+}
+
+//Heap bytes held per session while it waits at its first prompt, measured
+//by parking a batch of sessions and asking malloc how much it grew
+long LoadGenerator::measureIdleSessionBytes(unsigned int sessions) const {
+    int readerSlot = this->corpusEpochs.registerReader();
+    if (NO_READER_SLOT == readerSlot) {
+        return 0;
+    }
+    FastRandom rng(this->seed);
+    std::vector<std::unique_ptr<IdleSession> > parked;
+    parked.reserve(sessions);
+    long before = (long) mallinfo2().uordblks;
+    for (unsigned int i = 0u; i < sessions; i++) {
+        parked.push_back(std::unique_ptr<IdleSession>(
+                   new IdleSession(this->corpusEpochs, readerSlot, rng)));
+    }
+    long after = (long) mallinfo2().uordblks;
+    parked.clear();
+    this->corpusEpochs.unregisterReader(readerSlot);
+    return (after - before) / (long) sessions;
+}
@@ -0,0 +1,77 @@
+// Author: Forrest Miller
+// Filename: LoadGenerator.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef LoadGenerator_h
+#define LoadGenerator_h
+
+#include "BotPlayer.h"
+#include "EpochCorpus.h"
+#include "Dictionary.h"
+#include <ostream>
+#include <stdint.h>
+#include <string>
+
+//
+// Class Overview:
+//     This class drives the game at scale with simulated players, for sizing
+//     hardware and catching throughput regressions. It spreads a number of
+//     BotPlayers across worker threads; each worker plays its bots' whole
+//     games, one after another, through the real GameSession coroutine
+//     against the shared corpus. When they are all done it reports rounds per
+//     second, how often the bots were right, percentiles of the per-guess
+//     grading latency, and how much memory an idle session (as the server
+//     would hold one) costs.
+//
+// Valid States include: The class holds no state between runs.
+//
+// Anticipated Use:  Run from main() with --load-test.
+//
+// Class Invariants:  None
+//
+// Assumptions:
+//      -One corpus reader slot is free per worker thread.
+//      -The EpochCorpus and dictionary outlive the generator.
+//
+// Dependencies: BotPlayer, GameSession, EpochCorpus, Dictionary, FastRandom,
+//               EventLog, GameStats
+//
+
+class LoadGenerator {
+private:
+    EpochCorpus& corpusEpochs;
+    const Dictionary& dictionary;
+    uint64_t seed;
+    std::string eventLogDirectory;
+
+    void buildAnswerKey(AnswerKey&) const;
+    long measureIdleSessionBytes(unsigned int sessions) const;
+public:
+    LoadGenerator(EpochCorpus&, const Dictionary&, uint64_t seed);
+    //Description: Constructs a generator that plays against the corpus
+    //Preconditions: None
+    //Postconditions: None
+
+    void setEventLogDirectory(const std::string& directory);
+    //Description: Has every worker log its bots' rounds to its own EventLog
+    //             in the directory
+    //Preconditions: None
+    //Postconditions: None
+
+    bool run(unsigned int bots, int roundsPerBot, BotStrategy strategy,
+             unsigned int threads, std::ostream& report);
+    //Description: Plays 'bots' complete games of 'roundsPerBot' rounds on
+    //             'threads' worker threads (0 meaning one per hardware
+    //             thread) and writes the results to report. BOT_MIXED gives
+    //             the bots the other strategies in turn. Each worker needs a
+    //             corpus reader slot and a stats shard, so there are never
+    //             more workers than there are of those free (a warning says
+    //             so when that cuts the count).
+    //Preconditions: bots and roundsPerBot are positive
+    //Postconditions: Returns false (after printing why) if no worker could
+    //                get a slot and a shard; otherwise every bot has played
+    //                and the report has been written
+};
+
+#endif /* LoadGenerator_h */
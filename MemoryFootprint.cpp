@@ -0,0 +1,274 @@
+// Author: Forrest Miller
+// Filename: MemoryFootprint.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "MemoryFootprint.h"
+#include "SeqExtract.h"
+#include "SpasEnum.h"
+#include <stdio.h>
+#include <string.h>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the
+//          MemoryFootprint class. It is a friend of the classes it walks, so
+//          it can see their containers' capacities without them growing
+//          accessors only this report would use. An object's fields are
+//          whatever sizeof() gives less its strings and vtable pointer, so
+//          padding is counted with the fields.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const char * const FOOTPRINT_CATEGORY_NAMES[NUM_FOOTPRINT_CATEGORIES] = {
+    "fields", "vptr", "str hdr", "inline", "heap str", "slack", "index"};
+const char * const FOOTPRINT_PART_NAMES[NUM_FOOTPRINT_PARTS] = {
+    "Word arrays", "Dictionary", "Corpus", "Transform objects"};
+const double BYTES_PER_KIB = 1024.0;
+const int FOOTPRINT_LINE_BYTES = 160;
+
+//The string's inline buffer, including room for the terminator
+static const uint64_t INLINE_BUFFER_BYTES =
+    (uint64_t) std::string().capacity() + 1u;
+static const uint64_t STRING_HEADER_BYTES =
+    (uint64_t) sizeof(std::string) - INLINE_BUFFER_BYTES;
+//What a node of an unordered_set<string> holds besides the string
+static const uint64_t HASH_NODE_EXTRA_BYTES = sizeof(void *) + sizeof(size_t);
+
+static bool isInline(const std::string& str) {
+    const char * object = reinterpret_cast<const char *>(&str);
+    return str.data() >= object && str.data() < object + sizeof(str);
+}
+
+template <typename T>
+static uint64_t slackBytes(const std::vector<T>& vec) {
+    return (uint64_t) (vec.capacity() - vec.size()) * sizeof(T);
+}
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+MemoryFootprint::MemoryFootprint(void) {
+    memset(this->bytes, 0, sizeof(this->bytes));
+    memset(this->objects, 0, sizeof(this->objects));
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+void MemoryFootprint::addWordArrays(const std::string * const wordArrays[],
+                                    const int numWords[], int numLengths) {
+    for (int len = 0; len < numLengths &&
+                      len < (int) MAX_DICTIONARY_WORD_LENGTH; len++) {
+        if (nullptr == wordArrays[len]) {
+            continue;
+        }
+        for (int i = 0; i < numWords[len]; i++) {
+            addString(wordArrays[len][i], FOOTPRINT_WORD_ARRAYS, len,
+                      FOOTPRINT_NO_TRANSFORM);
+            this->objects[FOOTPRINT_WORD_ARRAYS][len]
+                         [FOOTPRINT_NO_TRANSFORM]++;
+        }
+    }
+}
+
+void MemoryFootprint::addDictionary(const Dictionary& dictionary) {
+    for (int len = 0; len < (int) MAX_DICTIONARY_WORD_LENGTH; len++) {
+        const std::vector<std::string>& words = dictionary.wordsByLength[len];
+        for (const std::string& word : words) {
+            addString(word, FOOTPRINT_DICTIONARY, len, FOOTPRINT_NO_TRANSFORM);
+        }
+        add(FOOTPRINT_DICTIONARY, len, FOOTPRINT_NO_TRANSFORM,
+            FOOTPRINT_VECTOR_SLACK, slackBytes(words));
+        this->objects[FOOTPRINT_DICTIONARY][len][FOOTPRINT_NO_TRANSFORM] +=
+        words.size();
+    }
+    //The hash set keeps a second copy of every word, in nodes of its own
+    for (const std::string& word : dictionary.knownWords) {
+        int len = (word.length() < MAX_DICTIONARY_WORD_LENGTH) ?
+                  (int) word.length() : FOOTPRINT_SHARED_LENGTH;
+        addString(word, FOOTPRINT_DICTIONARY, len, FOOTPRINT_NO_TRANSFORM);
+        add(FOOTPRINT_DICTIONARY, len, FOOTPRINT_NO_TRANSFORM,
+            FOOTPRINT_INDEX, HASH_NODE_EXTRA_BYTES);
+    }
+    add(FOOTPRINT_DICTIONARY, FOOTPRINT_SHARED_LENGTH, FOOTPRINT_NO_TRANSFORM,
+        FOOTPRINT_INDEX, (uint64_t) dictionary.knownWords.bucket_count() *
+        sizeof(void *));
+}
+
+void MemoryFootprint::addCorpus(const Corpus& corpus) {
+    const uint64_t puzzleFields = sizeof(Puzzle) - 2u * sizeof(std::string);
+    for (int len = 0; len < (int) MAX_DICTIONARY_WORD_LENGTH; len++) {
+        const std::vector<Puzzle>& puzzles = corpus.buckets[len];
+        for (const Puzzle& puzzle : puzzles) {
+            int transform = puzzle.getTransform();
+            add(FOOTPRINT_CORPUS, len, transform, FOOTPRINT_FIELDS,
+                puzzleFields);
+            addString(puzzle.originalWord, FOOTPRINT_CORPUS, len, transform);
+            addString(puzzle.encryptedWord, FOOTPRINT_CORPUS, len, transform);
+            this->objects[FOOTPRINT_CORPUS][len][transform]++;
+        }
+        add(FOOTPRINT_CORPUS, len, FOOTPRINT_NO_TRANSFORM,
+            FOOTPRINT_VECTOR_SLACK, slackBytes(puzzles));
+        const AliasSampler& sampler = corpus.samplers[len];
+        add(FOOTPRINT_CORPUS, len, FOOTPRINT_NO_TRANSFORM, FOOTPRINT_INDEX,
+            (uint64_t) (sampler.threshold.size() * sizeof(uint64_t) +
+                        sampler.alias.size() * sizeof(uint32_t)));
+        add(FOOTPRINT_CORPUS, len, FOOTPRINT_NO_TRANSFORM,
+            FOOTPRINT_VECTOR_SLACK, slackBytes(sampler.threshold) +
+            slackBytes(sampler.alias));
+    }
+}
+
+void MemoryFootprint::addTransformObject(const SequenceEnum& object,
+                                         int transform) {
+    int len = (object.originalWord.length() < MAX_DICTIONARY_WORD_LENGTH) ?
+              (int) object.originalWord.length() : FOOTPRINT_SHARED_LENGTH;
+    uint64_t size = sizeof(SequenceEnum);
+    uint64_t strings = 2u;
+    addString(object.originalWord, FOOTPRINT_TRANSFORMS, len, transform);
+    addString(object.word, FOOTPRINT_TRANSFORMS, len, transform);
+    if (DO_SEQ_EXTRACT == transform) {
+        size = sizeof(SeqExtract);
+        strings++;
+        addString(static_cast<const SeqExtract&>(object).substring,
+                  FOOTPRINT_TRANSFORMS, len, transform);
+    }
+    else if (DO_SPAS_ENUM == transform) {
+        size = sizeof(SpasEnum);
+        strings++;
+        addString(static_cast<const SpasEnum&>(object).substring,
+                  FOOTPRINT_TRANSFORMS, len, transform);
+    }
+    add(FOOTPRINT_TRANSFORMS, len, transform, FOOTPRINT_VTABLE,
+        sizeof(void *));
+    add(FOOTPRINT_TRANSFORMS, len, transform, FOOTPRINT_FIELDS,
+        size - sizeof(void *) - strings * sizeof(std::string));
+    this->objects[FOOTPRINT_TRANSFORMS][len][transform]++;
+}
+
+uint64_t MemoryFootprint::getBytes(int part, int category) const {
+    uint64_t total = 0u;
+    for (int len = 0; len < (int) MAX_DICTIONARY_WORD_LENGTH; len++) {
+        for (int transform = 0; transform <= SEQ_ENUM_VARIANTS; transform++) {
+            total += this->bytes[part][len][transform][category];
+        }
+    }
+    return total;
+}
+
+void MemoryFootprint::report(std::ostream& out) const {
+    for (int part = 0; part < NUM_FOOTPRINT_PARTS; part++) {
+        reportPart(out, part);
+    }
+    uint64_t total = 0u;
+    for (int part = 0; part < NUM_FOOTPRINT_PARTS; part++) {
+        for (int category = 0; category < NUM_FOOTPRINT_CATEGORIES;
+             category++) {
+            total += getBytes(part, category);
+        }
+    }
+    char line[FOOTPRINT_LINE_BYTES];
+    snprintf(line, sizeof(line), "Everything: %.1f KiB\n",
+             (double) total / BYTES_PER_KIB);
+    out << line;
+    out.flush();
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+void MemoryFootprint::addString(const std::string& str, int part, int length,
+                                int transform) {
+    add(part, length, transform, FOOTPRINT_STRING_HEADERS,
+        STRING_HEADER_BYTES);
+    add(part, length, transform, FOOTPRINT_INLINE_BUFFERS,
+        INLINE_BUFFER_BYTES);
+    if (!isInline(str)) {
+        add(part, length, transform, FOOTPRINT_HEAP_STRINGS,
+            (uint64_t) str.capacity() + 1u);
+    }
+}
+
+void MemoryFootprint::add(int part, int length, int transform, int category,
+                          uint64_t amount) {
+    this->bytes[part][length][transform][category] += amount;
+}
+
+//One row per length, then one per transform, of KiB in each category
+void MemoryFootprint::reportPart(std::ostream& out, int part) const {
+    uint64_t rows[MAX_DICTIONARY_WORD_LENGTH + SEQ_ENUM_VARIANTS + 1]
+                 [NUM_FOOTPRINT_CATEGORIES];
+    uint64_t counts[MAX_DICTIONARY_WORD_LENGTH + SEQ_ENUM_VARIANTS + 1];
+    memset(rows, 0, sizeof(rows));
+    memset(counts, 0, sizeof(counts));
+    const int byTransform = (int) MAX_DICTIONARY_WORD_LENGTH;
+    for (int len = 0; len < (int) MAX_DICTIONARY_WORD_LENGTH; len++) {
+        for (int transform = 0; transform <= SEQ_ENUM_VARIANTS; transform++) {
+            for (int category = 0; category < NUM_FOOTPRINT_CATEGORIES;
+                 category++) {
+                uint64_t amount = this->bytes[part][len][transform][category];
+                rows[len][category] += amount;
+                rows[byTransform + transform][category] += amount;
+            }
+            counts[len] += this->objects[part][len][transform];
+            counts[byTransform + transform] +=
+            this->objects[part][len][transform];
+        }
+    }
+    //Parts with nothing split by transform only get the rows by length
+    int lastRow = byTransform;
+    for (int transform = 0; transform < SEQ_ENUM_VARIANTS; transform++) {
+        if (counts[byTransform + transform] > 0u) {
+            lastRow = byTransform + SEQ_ENUM_VARIANTS + 1;
+        }
+    }
+    char line[FOOTPRINT_LINE_BYTES];
+    int used = snprintf(line, sizeof(line), "%-18s %7s",
+                        FOOTPRINT_PART_NAMES[part], "objects");
+    for (int category = 0; category < NUM_FOOTPRINT_CATEGORIES; category++) {
+        used += snprintf(line + used, sizeof(line) - (size_t) used, " %8s",
+                         FOOTPRINT_CATEGORY_NAMES[category]);
+    }
+    snprintf(line + used, sizeof(line) - (size_t) used, " %9s\n", "KiB");
+    out << line;
+    for (int row = 0; row < lastRow; row++) {
+        uint64_t total = 0u;
+        for (int category = 0; category < NUM_FOOTPRINT_CATEGORIES;
+             category++) {
+            total += rows[row][category];
+        }
+        if (0u == total) {
+            continue;
+        }
+        char name[FOOTPRINT_LINE_BYTES];
+        if (FOOTPRINT_SHARED_LENGTH == row) {
+            snprintf(name, sizeof(name), "  shared");
+        }
+        else if (row < byTransform) {
+            snprintf(name, sizeof(name), "  %d letters", row);
+        }
+        else if (byTransform + FOOTPRINT_NO_TRANSFORM == row) {
+            snprintf(name, sizeof(name), "  no transform");
+        }
+        else {
+            snprintf(name, sizeof(name), "  %s",
+                     PuzzleFactory::variantName(row - byTransform));
+        }
+        used = snprintf(line, sizeof(line), "%-18s %7llu", name,
+                        (unsigned long long) counts[row]);
+        for (int category = 0; category < NUM_FOOTPRINT_CATEGORIES;
+             category++) {
+            used += snprintf(line + used, sizeof(line) - (size_t) used,
+                             " %8.1f", (double) rows[row][category] /
+                             BYTES_PER_KIB);
+        }
+        snprintf(line + used, sizeof(line) - (size_t) used, " %9.1f\n",
+                 (double) total / BYTES_PER_KIB);
+        out << line;
+    }
+}
@@ -0,0 +1,113 @@
+// Author: Forrest Miller
+// Filename: MemoryFootprint.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef MemoryFootprint_h
+#define MemoryFootprint_h
+
+#include "Corpus.h"
+#include "Dictionary.h"
+#include "SequenceEnum.h"
+#include "PuzzleFactory.h"
+#include <ostream>
+#include <stdint.h>
+#include <string>
+
+//
+// Class Overview:
+//     This class walks the game's word data and adds up the bytes it takes,
+//     split by what the bytes are for, so containers can be sized from real
+//     numbers and a layout change can be shown to save what it claims. Every
+//     string is split into its header (pointer and length), its inline
+//     buffer, and the characters it keeps on the heap if they didn't fit
+//     inline. Every object's own fields (with their padding) and its vtable
+//     pointer are counted apart from its strings. Capacity a vector reserved
+//     but isn't using is counted as slack, and the dictionary's hash set and
+//     the corpus's alias tables as index. Bytes are kept per part (the
+//     static word arrays, the dictionary, the corpus, and the transform
+//     objects the corpus is built from), per word length and per transform.
+//
+//     Heap bytes are what was asked for, not counting the allocator's own
+//     headers and rounding. The hash set's nodes are estimated from the
+//     standard library's layout: a next pointer and a cached hash per word.
+//
+// Valid States include: Holding the footprint of whatever has been added.
+//
+// Anticipated Use:  main() adds each part after the first corpus is built
+//                   and prints the report with --footprint.
+//
+// Class Invariants:  -Nothing added is counted twice unless it is added
+//                     twice.
+//
+// Assumptions:
+//      -A string keeps its characters inline exactly when data() points
+//       inside the string object.
+//
+// Dependencies: Corpus, Dictionary, Puzzle, SequenceEnum, SeqExtract,
+//               SpasEnum, PuzzleFactory, AliasSampler
+//
+
+const int FOOTPRINT_FIELDS = 0;          //An object's own fields, less the rest
+const int FOOTPRINT_VTABLE = 1;          //vtable pointers
+const int FOOTPRINT_STRING_HEADERS = 2;  //Strings' pointer and length
+const int FOOTPRINT_INLINE_BUFFERS = 3;  //Strings' small-string buffers
+const int FOOTPRINT_HEAP_STRINGS = 4;    //String characters on the heap
+const int FOOTPRINT_VECTOR_SLACK = 5;    //Capacity reserved but unused
+const int FOOTPRINT_INDEX = 6;           //Hash set and alias tables
+const int NUM_FOOTPRINT_CATEGORIES = 7;
+
+const int FOOTPRINT_WORD_ARRAYS = 0;     //The static wrdNLtr arrays
+const int FOOTPRINT_DICTIONARY = 1;
+const int FOOTPRINT_CORPUS = 2;
+const int FOOTPRINT_TRANSFORMS = 3;      //SequenceEnum objects and subclasses
+const int NUM_FOOTPRINT_PARTS = 4;
+
+const int FOOTPRINT_NO_TRANSFORM = SEQ_ENUM_VARIANTS; //Shared by a length
+const int FOOTPRINT_SHARED_LENGTH = 0;   //Shared by every length
+
+class MemoryFootprint {
+private:
+    uint64_t bytes[NUM_FOOTPRINT_PARTS][MAX_DICTIONARY_WORD_LENGTH]
+                  [SEQ_ENUM_VARIANTS + 1][NUM_FOOTPRINT_CATEGORIES];
+    uint64_t objects[NUM_FOOTPRINT_PARTS][MAX_DICTIONARY_WORD_LENGTH]
+                    [SEQ_ENUM_VARIANTS + 1];
+
+    void addString(const std::string& str, int part, int length,
+                   int transform);
+    void add(int part, int length, int transform, int category,
+             uint64_t amount);
+    void reportPart(std::ostream& out, int part) const;
+
+    MemoryFootprint(const MemoryFootprint&);
+    MemoryFootprint& operator=(const MemoryFootprint&);
+public:
+    MemoryFootprint(void);
+    //Description: Constructs an empty footprint
+
+    void addWordArrays(const std::string * const wordArrays[],
+                       const int numWords[], int numLengths);
+    //Description: Adds the strings in the static word arrays
+    //Preconditions: Same arrays the corpus was constructed over
+
+    void addDictionary(const Dictionary& dictionary);
+    //Description: Adds the dictionary's sorted word lists and hash set
+
+    void addCorpus(const Corpus& corpus);
+    //Description: Adds the corpus's puzzles and alias tables
+    //Preconditions: The corpus is built
+
+    void addTransformObject(const SequenceEnum& object, int transform);
+    //Description: Adds one transform object, which was made by the given
+    //             transform (see PuzzleFactory)
+
+    uint64_t getBytes(int part, int category) const;
+    //Description: Returns the part's bytes in the category, over every
+    //             length and transform
+
+    void report(std::ostream& out) const;
+    //Description: Prints, for every part, a table of KiB by category for
+    //             each word length and for each transform
+};
+
+#endif /* MemoryFootprint_h */
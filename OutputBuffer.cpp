@@ -0,0 +1,208 @@
+// Author: Forrest Miller
+// Filename: OutputBuffer.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "OutputBuffer.h"
+#include <charconv>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the OutputBuffer
+//          class. Copied text that lands right after the previous copied
+//          fragment just extends it, so a run of small appends still costs a
+//          single iovec.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const int MAX_IO_VECTORS = 64; //Per call; the rest goes on the next call
+const int NUMBER_TEXT_SIZE = 32;
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+OutputBuffer::OutputBuffer(void) {
+    this->firstFragment = 0;
+    this->pendingBytes = 0;
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+void OutputBuffer::appendStatic(const char * text, size_t length) {
+    if (0 == length) {
+        return;
+    }
+    Fragment fragment = {text, 0, length};
+    this->fragments.push_back(fragment);
+    this->pendingBytes += length;
+}
+
+void OutputBuffer::appendStatic(const std::string& text) {
+    appendStatic(text.data(), text.length());
+}
+
+void OutputBuffer::append(const char * text, size_t length) {
+    if (0 == length) {
+        return;
+    }
+    size_t offset = this->scratch.length();
+    this->scratch.append(text, length);
+    this->pendingBytes += length;
+    if (this->fragments.size() > this->firstFragment) {
+        Fragment& last = this->fragments.back();
+        if (nullptr == last.text && last.offset + last.length == offset) {
+            last.length += length;
+            return;
+        }
+    }
+    Fragment fragment = {nullptr, offset, length};
+    this->fragments.push_back(fragment);
+}
+
+void OutputBuffer::append(const std::string& text) {
+    append(text.data(), text.length());
+}
+
+void OutputBuffer::append(char c) {
+    append(&c, 1);
+}
+
+void OutputBuffer::appendInt(long value) {
+    char text[NUMBER_TEXT_SIZE];
+    std::to_chars_result end = std::to_chars(text, text + sizeof(text), value);
+    append(text, (size_t) (end.ptr - text));
+}
+
+void OutputBuffer::appendFloat(float value) {
+    char text[NUMBER_TEXT_SIZE];
+    int length = snprintf(text, sizeof(text), "%g", value); //cout's format
+    append(text, (size_t) length);
+}
+
+size_t OutputBuffer::length(void) const {
+    return this->pendingBytes;
+}
+
+bool OutputBuffer::empty(void) const {
+    return 0 == this->pendingBytes;
+}
+
+std::string OutputBuffer::toString(void) const {
+    std::string copy;
+    copy.reserve(this->pendingBytes);
+    for (size_t i = this->firstFragment; i < this->fragments.size(); i++) {
+        const Fragment& fragment = this->fragments[i];
+        const char * text = fragment.text ? fragment.text :
+        this->scratch.data() + fragment.offset;
+        copy.append(text, fragment.length);
+    }
+    return copy;
+}
+
+bool OutputBuffer::endsWith(const char * text, size_t length) const {
+    if (length > this->pendingBytes) {
+        return false;
+    }
+    size_t i = this->fragments.size();
+    while (length > 0 && i > this->firstFragment) {
+        i--;
+        const Fragment& fragment = this->fragments[i];
+        const char * fragmentText = fragment.text ? fragment.text :
+        this->scratch.data() + fragment.offset;
+        size_t compared = (length < fragment.length) ? length : fragment.length;
+        if (0 != memcmp(fragmentText + fragment.length - compared,
+                        text + length - compared, compared)) {
+            return false;
+        }
+        length -= compared;
+    }
+    return 0 == length;
+}
+
+ssize_t OutputBuffer::writeTo(int fd) {
+    struct iovec vectors[MAX_IO_VECTORS];
+    int count = gatherVectors(vectors, MAX_IO_VECTORS);
+    if (0 == count) {
+        return 0;
+    }
+    ssize_t written = writev(fd, vectors, count);
+    if (written > 0) {
+        consume((size_t) written);
+    }
+    return written;
+}
+
+ssize_t OutputBuffer::sendTo(int socketFd) {
+    struct iovec vectors[MAX_IO_VECTORS];
+    int count = gatherVectors(vectors, MAX_IO_VECTORS);
+    if (0 == count) {
+        return 0;
+    }
+    struct msghdr message;
+    memset(&message, 0, sizeof(message));
+    message.msg_iov = vectors;
+    message.msg_iovlen = (size_t) count;
+    ssize_t sent = sendmsg(socketFd, &message, MSG_NOSIGNAL);
+    if (sent > 0) {
+        consume((size_t) sent);
+    }
+    return sent;
+}
+
+void OutputBuffer::clear(void) {
+    this->fragments.clear();
+    this->scratch.clear();
+    this->firstFragment = 0;
+    this->pendingBytes = 0;
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+
+//Drops bytes from the front after a (possibly partial) write
+void OutputBuffer::consume(size_t bytes) {
+    this->pendingBytes -= bytes;
+    while (bytes > 0) {
+        Fragment& fragment = this->fragments[this->firstFragment];
+        if (bytes < fragment.length) {
+            if (fragment.text) {
+                fragment.text += bytes;
+            }
+            else {
+                fragment.offset += bytes;
+            }
+            fragment.length -= bytes;
+            return;
+        }
+        bytes -= fragment.length;
+        this->firstFragment++;
+    }
+    if (0 == this->pendingBytes) {
+        clear();
+    }
+}
+
+int OutputBuffer::gatherVectors(struct iovec * vectors, int maxVectors) const {
+    int count = 0;
+    for (size_t i = this->firstFragment;
+         i < this->fragments.size() && count < maxVectors; i++) {
+        const Fragment& fragment = this->fragments[i];
+        const char * text = fragment.text ? fragment.text :
+        this->scratch.data() + fragment.offset;
+        vectors[count].iov_base = (void *) text;
+        vectors[count].iov_len = fragment.length;
+        count++;
+    }
+    return count;
+}
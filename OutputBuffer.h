@@ -0,0 +1,102 @@
+// Author: Forrest Miller
+// Filename: OutputBuffer.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef OutputBuffer_h
+#define OutputBuffer_h
+
+#include <stddef.h>
+#include <string>
+#include <sys/types.h>
+#include <vector>
+
+//
+// Class Overview:
+//     This class collects everything a game writes between two reads of
+//     input and hands it to the kernel in one writev() (or sendmsg() for
+//     sockets), instead of one flush per std::endl. Text is kept as a list of
+//     fragments: fixed text (prompts, the rules) is referenced where it
+//     already lives and never copied, and only the parts that change (the
+//     puzzle, the score) are copied, into a scratch area that is reused from
+//     one round to the next. A partial write just drops the bytes that made
+//     it, so a socket that is not ready for everything can be finished later.
+//
+// Valid States include: Empty or holding pending output.
+//
+// Anticipated Use:  One per GameChannel. The game appends to it, and the
+//                   channel's owner writes it to the terminal or a socket.
+//
+// Class Invariants:  -Pending output is the fragments in order, with the
+//                     bytes already written dropped from the front.
+//                    -Clearing keeps the allocated capacity for reuse.
+//
+// Assumptions:
+//      -Static text outlives the pending output it is part of (string
+//       literals and namespace-scope constants do).
+//
+// Dependencies: None
+//
+
+class OutputBuffer {
+private:
+    struct Fragment {
+        const char * text;   //Static text, or nullptr if in scratch
+        size_t offset;       //Where the copied text starts in scratch
+        size_t length;
+    };
+    std::vector<Fragment> fragments;
+    size_t firstFragment;    //Fragments before this are fully written
+    std::string scratch;
+    size_t pendingBytes;
+
+    void consume(size_t bytes);
+    int gatherVectors(struct iovec * vectors, int maxVectors) const;
+public:
+    OutputBuffer(void);
+    //Description: Constructs an empty buffer
+
+    template <size_t N>
+    void appendLiteral(const char (&text)[N]) {
+    //Description: Appends a string literal without copying it
+        appendStatic(text, N - 1);
+    }
+
+    void appendStatic(const char * text, size_t length);
+    void appendStatic(const std::string& text);
+    //Description: Appends text without copying it
+    //Preconditions: The text must not change or go away until it is written
+
+    void append(const char * text, size_t length);
+    void append(const std::string& text);
+    void append(char c);
+    void appendInt(long value);
+    void appendFloat(float value);
+    //Description: Copy text (or format a number, like cout would) into the
+    //             buffer
+
+    size_t length(void) const;
+    bool empty(void) const;
+    //Description: Return how much output is pending
+
+    std::string toString(void) const;
+    //Description: Returns a copy of the pending output
+
+    bool endsWith(const char * text, size_t length) const;
+    //Description: Returns true if the pending output ends with the text
+
+    ssize_t writeTo(int fd);
+    //Description: Writes as much pending output as the descriptor takes in
+    //             one writev() call, and drops what was written
+    //Preconditions: None
+    //Postconditions: Returns the bytes written, or -1 with errno set
+
+    ssize_t sendTo(int socketFd);
+    //Description: Like writeTo(), but with sendmsg() and MSG_NOSIGNAL so a
+    //             player hanging up is an error instead of a SIGPIPE
+
+    void clear(void);
+    //Description: Drops all pending output, keeping the buffer's capacity
+};
+
+#endif /* OutputBuffer_h */
@@ -0,0 +1,125 @@
+// Author: Forrest Miller
+// Filename: PerfCounters.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "PerfCounters.h"
+#include <errno.h>
+#include <iostream>
+#include <linux/perf_event.h>
+#include <string.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the PerfCounters
+//          class. The group is read in one read() with PERF_FORMAT_GROUP,
+//          which returns the number of counters, the time the group was
+//          enabled and running, and then each count in the order the
+//          counters were opened.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const int NO_COUNTER = -1;
+const uint64_t PERF_EVENTS[NUM_PERF_COUNTERS] = {PERF_COUNT_HW_CPU_CYCLES,
+    PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES,
+    PERF_COUNT_HW_BRANCH_MISSES};
+const char * const PERF_COUNTER_NAMES[NUM_PERF_COUNTERS] = {"cycles",
+    "instructions", "cache-misses", "branch-misses"};
+
+//What a PERF_FORMAT_GROUP read returns
+struct GroupReading {
+    uint64_t counters;
+    uint64_t timeEnabled;
+    uint64_t timeRunning;
+    uint64_t values[NUM_PERF_COUNTERS];
+};
+
+static int openCounter(uint64_t event, int groupFd) {
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = event;
+    attr.disabled = (NO_COUNTER == groupFd) ? 1 : 0; //The leader starts all
+    attr.exclude_kernel = 1; //Allowed at perf_event_paranoid 2
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP | PERF_FORMAT_TOTAL_TIME_ENABLED |
+                       PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return (int) syscall(SYS_perf_event_open, &attr, 0, -1, groupFd,
+                         PERF_FLAG_FD_CLOEXEC);
+}
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+PerfCounters::PerfCounters(void) {
+    for (int i = 0; i < NUM_PERF_COUNTERS; i++) {
+        this->fds[i] = NO_COUNTER;
+    }
+}
+
+PerfCounters::~PerfCounters(void) {
+    for (int i = 0; i < NUM_PERF_COUNTERS; i++) {
+        if (NO_COUNTER != this->fds[i]) {
+            close(this->fds[i]);
+        }
+    }
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+bool PerfCounters::open(void) {
+    for (int i = 0; i < NUM_PERF_COUNTERS; i++) {
+        this->fds[i] = openCounter(PERF_EVENTS[i], this->fds[0]);
+        if (this->fds[i] < 0) {
+            std::cerr << "Hardware counters unavailable (" <<
+            PERF_COUNTER_NAMES[i] << ": " << strerror(errno) <<
+            "), benchmarking without them" << std::endl;
+            for (int j = 0; j <= i; j++) {
+                if (this->fds[j] >= 0) {
+                    close(this->fds[j]);
+                }
+                this->fds[j] = NO_COUNTER;
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+bool PerfCounters::isOpen(void) const {
+    return NO_COUNTER != this->fds[0];
+}
+
+void PerfCounters::start(void) {
+    ioctl(this->fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    ioctl(this->fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+}
+
+bool PerfCounters::stop(PerfSample& sample) {
+    ioctl(this->fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+    GroupReading reading;
+    ssize_t got = read(this->fds[0], &reading, sizeof(reading));
+    if (got != (ssize_t) sizeof(reading) ||
+        NUM_PERF_COUNTERS != reading.counters || 0u == reading.timeRunning) {
+        return false;
+    }
+    //Scale up for the time the group was multiplexed off the hardware
+    double scale = (double) reading.timeEnabled / (double) reading.timeRunning;
+    for (int i = 0; i < NUM_PERF_COUNTERS; i++) {
+        sample.counts[i] = (uint64_t) ((double) reading.values[i] * scale);
+    }
+    return true;
+}
+
+const char * PerfCounters::counterName(int counter) {
+    return PERF_COUNTER_NAMES[counter];
+}
@@ -0,0 +1,85 @@
+// Author: Forrest Miller
+// Filename: PerfCounters.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef PerfCounters_h
+#define PerfCounters_h
+
+#include <stdint.h>
+
+//
+// Class Overview:
+//     This class reads the CPU's hardware event counters around a piece of
+//     code through Linux's perf_event_open(), so a benchmark can say why an
+//     operation is slow and not only how slow: cycles, instructions retired,
+//     cache misses and branch mispredictions. The four counters are opened as
+//     one group, so they are always counted over exactly the same stretch of
+//     code. If the kernel had to share the hardware with other groups the
+//     counts are scaled up by the fraction of time the group was counting.
+//     Only this thread's user-space events are counted.
+//
+// Valid States include: Closed (the counters could not be opened, or open()
+//                       has not been called), open, and counting (between
+//                       start() and stop()).
+//
+// Anticipated Use:  The benchmark runner opens one set per run and wraps
+//                   each timed repetition in start()/stop().
+//
+// Class Invariants:  -Counts are only read while the group is stopped.
+//
+// Assumptions:
+//      -Linux, and perf_event_paranoid no higher than 2 (or CAP_PERFMON).
+//       Virtual machines often don't pass the counters through, in which
+//       case open() fails and the benchmarks run without them.
+//
+// Dependencies: None
+//
+
+const int PERF_CYCLES = 0;
+const int PERF_INSTRUCTIONS = 1;
+const int PERF_CACHE_MISSES = 2;
+const int PERF_BRANCH_MISSES = 3;
+const int NUM_PERF_COUNTERS = 4;
+
+struct PerfSample {
+    uint64_t counts[NUM_PERF_COUNTERS];
+};
+
+class PerfCounters {
+private:
+    int fds[NUM_PERF_COUNTERS]; //fds[0] leads the group
+
+    PerfCounters(const PerfCounters&);
+    PerfCounters& operator=(const PerfCounters&);
+public:
+    PerfCounters(void);
+    //Description: Constructs a closed set of counters
+
+    ~PerfCounters(void);
+    //Description: Closes the counters
+
+    bool open(void);
+    //Description: Opens the four counters for the calling thread
+    //Preconditions: Not already open
+    //Postconditions: Returns false (after printing why) if the kernel or the
+    //                machine doesn't allow them; the set stays closed
+
+    bool isOpen(void) const;
+    //Description: Returns true if open() succeeded
+
+    void start(void);
+    //Description: Zeroes the counters and starts counting
+    //Preconditions: Open
+
+    bool stop(PerfSample& sample);
+    //Description: Stops counting and reads the counts since start()
+    //Preconditions: Open, and start() was called
+    //Postconditions: Returns false if the counts couldn't be read (or the
+    //                group never got to count)
+
+    static const char * counterName(int counter);
+    //Description: Returns a short name for the counter ("cycles", ...)
+};
+
+#endif /* PerfCounters_h */
@@ -0,0 +1,90 @@
+// Author: Forrest Miller
+// Filename: Puzzle.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "Puzzle.h"
+#include "Instrumentation.h"
+#include "AllocationTracker.h"
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the Puzzle class.
+//          Everything is read-only after the constructor runs, which is the
+//          whole point of the class.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const char PUZZLE_CAP_A = 'A';
+const char PUZZLE_CAP_Z = 'Z';
+const char PUZZLE_CASE_OFFSET = 'a' - 'A';
+
+static inline char lowerCaseLetter(char c) {
+    if (c >= PUZZLE_CAP_A && c <= PUZZLE_CAP_Z) {
+        return (char) (c + PUZZLE_CASE_OFFSET);
+    }
+    return c;
+}
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+Puzzle::Puzzle(const std::string& word, const SequenceEnum& source,
+               int transformUsed, int indexOfWord)
+: originalWord(word), encryptedWord(source.emitWord()) {
+    for (unsigned long i = 0ul; i < this->originalWord.length(); i++) {
+        this->originalWord[i] = lowerCaseLetter(this->originalWord[i]);
+    }
+    this->transform = transformUsed;
+    this->ambiguityCount = source.getAmbiguityCount();
+    this->wordIndex = indexOfWord;
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+const std::string& Puzzle::emitWord(bool encryptionIsActive) const {
+    ProbeTimer timer(PROBE_EMIT_WORD);
+    if (encryptionIsActive) {
+        return this->encryptedWord;
+    }
+    return this->originalWord;
+}
+
+bool Puzzle::guessWord(const std::string& guess) const {
+    return guessWord(guess.data(), guess.length());
+}
+
+bool Puzzle::guessWord(const char * guess, size_t length) const {
+    ProbeTimer timer(PROBE_GUESS_WORD);
+    AllocationScope scope(ALLOC_GRADING);
+    if (length != this->originalWord.length()) {
+        return false;
+    }
+    for (unsigned long i = 0ul; i < length; i++) {
+        if (lowerCaseLetter(guess[i]) != this->originalWord[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+int Puzzle::getTransform(void) const {
+    return this->transform;
+}
+
+unsigned int Puzzle::getAmbiguityCount(void) const {
+    return this->ambiguityCount;
+}
+
+unsigned long Puzzle::getWordLength(void) const {
+    return (unsigned long) this->originalWord.length();
+}
+
+int Puzzle::getWordIndex(void) const {
+    return this->wordIndex;
+}
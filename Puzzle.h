@@ -0,0 +1,84 @@
+// Author: Forrest Miller
+// Filename: Puzzle.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef Puzzle_h
+#define Puzzle_h
+
+#include "SequenceEnum.h"
+#include <string>
+
+//
+// Class Overview:
+//     This class is an immutable snapshot of one generated puzzle: the
+//     original word, the word as modified by one of the SequenceEnum family
+//     of objects, which transform produced it, and how many dictionary words
+//     could have produced it. Nothing about a Puzzle can change after it is
+//     constructed, so every accessor is a plain read and one Puzzle can be
+//     shared by any number of threads and game sessions at once without
+//     locks. Which form of the word a particular player is currently being
+//     shown is per-session state, and lives in a PuzzleView instead.
+//
+// Valid States include: A Puzzle is always in the state it was constructed in.
+//
+// Anticipated Use:  Built from a freshly constructed SequenceEnum, SeqExtract
+//                   or SpasEnum (which do the actual transforming) and then
+//                   stored in the shared corpus or the puzzle pool.
+//
+// Class Invariants:  -The original word is lowercase.
+//                    -No member changes after construction.
+//
+// Assumptions:
+//      -The source object passed to the constructor is in its freshly
+//       constructed state, so emitWord() returns the modified word.
+//
+// Dependencies: SequenceEnum
+//
+
+class Puzzle {
+private:
+    std::string originalWord;
+    std::string encryptedWord;
+    int transform;          //DO_SEQ_ENUM, DO_SEQ_EXTRACT or DO_SPAS_ENUM
+    unsigned int ambiguityCount;
+    int wordIndex;          //Index of the word in its length's word array
+
+    friend class MemoryFootprint; //Reports the memory it takes
+public:
+    Puzzle(const std::string& word, const SequenceEnum& source, int transform,
+           int wordIndex);
+    //Description: Snapshots the source object's emitted word along with the
+    //             original word and the source's ambiguity count
+    //Preconditions: source must have been built from 'word'
+    //Postconditions: Puzzle is complete and will never change
+
+    const std::string& emitWord(bool encryptionIsActive) const;
+    //Description: Returns the modified word, or the original word if
+    //             encryptionIsActive is false
+    //Preconditions: None
+    //Postconditions: None, this method is const
+
+    bool guessWord(const std::string&) const;
+    bool guessWord(const char * guess, size_t length) const;
+    //Description: Returns true if the guess matches the original word,
+    //             ignoring case. Does not allocate.
+    //Preconditions: None
+    //Postconditions: None, this method is const
+
+    int getTransform(void) const;
+    //Description: Returns which transform made the puzzle (see PuzzleFactory)
+
+    unsigned int getAmbiguityCount(void) const;
+    //Description: Returns how many dictionary words could have produced the
+    //             modified word (0 if it was never computed)
+
+    unsigned long getWordLength(void) const;
+    //Description: Returns the length of the original word
+
+    int getWordIndex(void) const;
+    //Description: Returns the index of the original word in the word array
+    //             for its length
+};
+
+#endif /* Puzzle_h */
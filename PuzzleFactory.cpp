@@ -0,0 +1,171 @@
+// Author: Forrest Miller
+// Filename: PuzzleFactory.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "PuzzleFactory.h"
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the PuzzleFactory
+//          class. The substring rules for each word length are the same ones
+//          the driver has always used (including the order random numbers are
+//          drawn in), so a seeded run builds the same corpus as before.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const int SECND_LTR_OF_WRD_INDX = 1; //string.at(1) is second letter
+const int THREE_LETTERS = 3;
+const int FOUR_LETTERS = 4;
+const int FIVE_LETTERS = 5;
+const int SIX_LETTERS = 6;
+const int EIGHT_LETTERS = 8;
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+SequenceEnum * PuzzleFactory::makePuzzle(const std::string& word,
+                                         int * variantOut) {
+    int sequenceEnumToDo = randomVariant();
+    if (nullptr != variantOut) {
+        *variantOut = sequenceEnumToDo;
+    }
+    return makeVariant(word, sequenceEnumToDo);
+}
+
+SequenceEnum * PuzzleFactory::makeVariant(const std::string& word,
+                                          int variant) {
+    if (DO_SEQ_ENUM == variant) {
+        return new SequenceEnum(word);
+    }
+    else if (DO_SEQ_EXTRACT == variant) {
+        return new SeqExtract(word, chooseExtractSubstring(word));
+    }
+    return new SpasEnum(word); //DO_SPAS_ENUM
+}
+
+void PuzzleFactory::makePuzzles(const std::string * words, int numWords,
+                                std::vector<SequenceEnum *>& puzzles,
+                                std::vector<int> * variants) {
+    int variant;
+    for (int i = 0; i < numWords; i++) {
+        puzzles.push_back(makePuzzle(words[i], &variant));
+        if (nullptr != variants) {
+            variants->push_back(variant);
+        }
+    }
+}
+
+int PuzzleFactory::randomVariant(void) {
+    return SequenceEnum::randomInt() % SEQ_ENUM_VARIANTS;
+}
+
+//Builds the puzzle on the stack; batch runs encrypt millions of words and
+//the heap allocation would cost more than the encryption
+std::string PuzzleFactory::encryptWord(const std::string& word, int variant) {
+    if (DO_SEQ_ENUM == variant) {
+        SequenceEnum puzzle(word);
+        return puzzle.emitWord();
+    }
+    else if (DO_SEQ_EXTRACT == variant) {
+        SeqExtract puzzle(word, chooseExtractSubstring(word));
+        return puzzle.emitWord();
+    }
+    SpasEnum puzzle(word);
+    return puzzle.emitWord();
+}
+
+const char * PuzzleFactory::variantName(int variant) {
+    if (DO_SEQ_ENUM == variant) {
+        return "SequenceEnum";
+    }
+    else if (DO_SEQ_EXTRACT == variant) {
+        return "SeqExtract";
+    }
+    return "SpasEnum";
+}
+
+bool PuzzleFactory::parseVariant(const std::string& name, int& variant) {
+    if ("enum" == name) {
+        variant = DO_SEQ_ENUM;
+    }
+    else if ("extract" == name) {
+        variant = DO_SEQ_EXTRACT;
+    }
+    else if ("spas" == name) {
+        variant = DO_SPAS_ENUM;
+    }
+    else if ("random" == name) {
+        variant = RANDOM_VARIANT;
+    }
+    else {
+        return false;
+    }
+    return true;
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+
+//Picks the substring a SeqExtract will remove. The start is never the first
+//letter, and the length is kept low enough that the word stays guessable.
+std::string PuzzleFactory::chooseExtractSubstring(const std::string& word) {
+    const int wordLength = (int) word.length();
+    int substrStartIndex;
+    int substrLength;
+    if (THREE_LETTERS == wordLength) {
+        //For 3 letter words, only extract middle letter
+        return word.substr(SECND_LTR_OF_WRD_INDX, SECND_LTR_OF_WRD_INDX);
+    }
+    //(rand() % (length - 1)) + 1
+    substrStartIndex = (SequenceEnum::randomInt() %
+                        (wordLength - SECND_LTR_OF_WRD_INDX)) +
+                        SECND_LTR_OF_WRD_INDX;
+    if (substrStartIndex > SECND_LTR_OF_WRD_INDX) {
+        if (FOUR_LETTERS == wordLength) {
+            substrLength = SECND_LTR_OF_WRD_INDX; //aka substrLength = 1
+        }
+        else if (FIVE_LETTERS == wordLength) {
+            substrLength = (SequenceEnum::randomInt() % SECND_LTR_OF_WRD_INDX) +
+            SECND_LTR_OF_WRD_INDX;
+        }
+        else if (SIX_LETTERS == wordLength) {
+            substrLength = SequenceEnum::randomInt() %
+                           (SIX_LETTERS - SECND_LTR_OF_WRD_INDX -
+                            (FIVE_LETTERS - substrStartIndex)) +
+                           SECND_LTR_OF_WRD_INDX;
+        }
+        else {
+            substrLength = (SequenceEnum::randomInt() % THREE_LETTERS) +
+            SECND_LTR_OF_WRD_INDX;
+        }
+        //Need to make sure substrLength isn't too long
+        if ((substrLength + substrStartIndex) > wordLength) {
+            substrLength = wordLength - substrStartIndex;
+        }
+    }
+    else { //I am keeping the length low here so that the words are not
+        //   impossible to guess
+        if (FOUR_LETTERS == wordLength) {
+            substrLength = SequenceEnum::randomInt() % SECND_LTR_OF_WRD_INDX;
+        }
+        else if (FIVE_LETTERS == wordLength) {
+            substrLength = (SequenceEnum::randomInt() % THREE_LETTERS) +
+            SECND_LTR_OF_WRD_INDX;
+        }
+        else if (wordLength <= EIGHT_LETTERS) {
+            substrLength = (SequenceEnum::randomInt() % FOUR_LETTERS) +
+            SECND_LTR_OF_WRD_INDX;
+        }
+        else {
+            substrLength = (SequenceEnum::randomInt() % FIVE_LETTERS) +
+            SECND_LTR_OF_WRD_INDX;
+        }
+    }
+    return word.substr(substrStartIndex, substrLength);
+}
@@ -0,0 +1,97 @@
+// Author: Forrest Miller
+// Filename: PuzzleFactory.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef PuzzleFactory_h
+#define PuzzleFactory_h
+
+#include "SequenceEnum.h"
+#include "SeqExtract.h"
+#include "SpasEnum.h"
+#include <string>
+#include <vector>
+
+//
+// Class Overview:
+//     This class holds the logic for turning a word into a puzzle: picking
+//     one of the three SequenceEnum variants at random and, for SeqExtract,
+//     picking a substring to remove that keeps the word guessable for its
+//     length. This logic used to be written out once per word length inside
+//     main(); keeping it here lets the initial corpus and the background
+//     puzzle pool build puzzles the exact same way.
+//
+// Valid States include: The class only has static methods and holds no state.
+//
+// Anticipated Use:  Called for every word when the corpus is built, and by
+//                   any thread that needs fresh puzzles.
+//
+// Class Invariants:  None
+//
+// Assumptions:
+//      -Words are at least 3 letters long and contain only letters.
+//      -All random choices come from SequenceEnum::randomInt(), so a thread
+//       that has set its own random source builds puzzles without touching
+//       rand().
+//
+// Dependencies: SequenceEnum, SeqExtract, SpasEnum
+//
+
+const int DO_SEQ_ENUM = 0;
+const int DO_SEQ_EXTRACT = 1;
+const int DO_SPAS_ENUM = 2;
+const int SEQ_ENUM_VARIANTS = 3; //3 types of sequence enum
+const int RANDOM_VARIANT = -1;   //Let the factory pick one of the three
+
+class PuzzleFactory {
+private:
+    static std::string chooseExtractSubstring(const std::string&);
+public:
+    static SequenceEnum * makePuzzle(const std::string& word,
+                                     int * variantOut = nullptr);
+    //Description: Builds a randomly chosen SequenceEnum, SeqExtract or
+    //             SpasEnum for the word on the heap.
+    //Preconditions: Word must be at least 3 letters long
+    //Postconditions: Caller owns the returned object and must delete it. If
+    //                variantOut is not null it receives which variant
+    //                (DO_SEQ_ENUM, DO_SEQ_EXTRACT or DO_SPAS_ENUM) was built.
+
+    static SequenceEnum * makeVariant(const std::string& word, int variant);
+    //Description: Builds a puzzle of the given variant for the word on the
+    //             heap
+    //Preconditions: Word must be at least 3 letters long, and variant one of
+    //               DO_SEQ_ENUM, DO_SEQ_EXTRACT or DO_SPAS_ENUM
+    //Postconditions: Caller owns the returned object and must delete it
+
+    static void makePuzzles(const std::string * words, int numWords,
+                            std::vector<SequenceEnum *>& puzzles,
+                            std::vector<int> * variants = nullptr);
+    //Description: Appends one puzzle per word to the vector, in word order,
+    //             and (if variants is not null) which variant each one is
+    //Preconditions: words must point to at least numWords strings
+    //Postconditions: Caller owns the appended objects
+
+    static int randomVariant(void);
+    //Description: Picks one of the three variants the way makePuzzle() does
+    //Preconditions: None
+    //Postconditions: One random number has been drawn
+
+    static std::string encryptWord(const std::string& word, int variant);
+    //Description: Returns the word encrypted by the given variant without
+    //             keeping a puzzle object around, for tools that only want
+    //             the text
+    //Preconditions: Word must be at least 3 letters long, and variant one of
+    //               DO_SEQ_ENUM, DO_SEQ_EXTRACT or DO_SPAS_ENUM
+    //Postconditions: None
+
+    static const char * variantName(int variant);
+    //Description: Returns the class name of the variant ("SequenceEnum",
+    //             "SeqExtract" or "SpasEnum")
+
+    static bool parseVariant(const std::string& name, int& variant);
+    //Description: Reads "enum", "extract", "spas" or "random" into variant
+    //Preconditions: None
+    //Postconditions: Returns false (leaving variant alone) for other names
+};
+
+#endif /* PuzzleFactory_h */
@@ -0,0 +1,200 @@
+// Author: Forrest Miller
+// Filename: PuzzlePool.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "PuzzlePool.h"
+#include "PuzzleFactory.h"
+#include "AmbiguityJob.h"
+#include "AllocationTracker.h"
+#include <atomic>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the PuzzlePool class.
+//          The producer tops up every ring by one puzzle per pass, so all
+//          lengths refill evenly. After a pass that added nothing it sleeps
+//          until the consumer takes a puzzle. The consumer only touches the
+//          lock when the producer has said it is asleep; the fences on both
+//          sides make sure that either the producer sees the take or the
+//          consumer sees it waiting.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+//   Implementation Invariants:
+//        The producer thread is the only thread that pushes into the rings.
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const size_t PUZZLES_PER_LENGTH = 64; //Ring capacity for each word length
+const int MAX_BUILD_ATTEMPTS = 4; //Tries at an unambiguous puzzle per slot
+const unsigned int ONE_VALID_ANSWER = 1u;
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+PuzzlePool::PuzzlePool(EpochCorpus& epochs, const Dictionary& dict,
+                       uint64_t producerSeed)
+: corpusEpochs(epochs), dictionary(dict) {
+    this->numLengths = (int) MAX_DICTIONARY_WORD_LENGTH;
+    this->seed = producerSeed;
+    this->keepProducing = false;
+    this->puzzlesTaken.store(0u);
+    this->producerWaiting.store(false);
+    this->rings.resize(this->numLengths);
+    for (int len = 0; len < this->numLengths; len++) {
+        this->rings[len].reset(new SpscRing<Puzzle *>(PUZZLES_PER_LENGTH));
+    }
+}
+
+PuzzlePool::~PuzzlePool(void) {
+    stop();
+    drain();
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+void PuzzlePool::start(void) {
+    if (this->producer.joinable()) {
+        return; //Already running
+    }
+    this->keepProducing = true;
+    this->producer = std::thread(&PuzzlePool::produce, this);
+}
+
+void PuzzlePool::stop(void) {
+    {
+        std::lock_guard<std::mutex> guard(this->producerLock);
+        this->keepProducing = false;
+    }
+    this->producerWake.notify_all();
+    if (this->producer.joinable()) {
+        this->producer.join();
+    }
+}
+
+Puzzle * PuzzlePool::takePuzzle(int length) {
+    if (length < 0 || length >= this->numLengths ||
+        !this->rings[length]) {
+        return nullptr;
+    }
+    Puzzle * puzzle = nullptr;
+    if (!this->rings[length]->tryPop(puzzle)) {
+        return nullptr;
+    }
+    this->puzzlesTaken.store(this->puzzlesTaken.load(
+                             std::memory_order_relaxed) + 1u);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (this->producerWaiting.load(std::memory_order_relaxed)) {
+        wakeProducer();
+    }
+    return puzzle;
+}
+
+size_t PuzzlePool::getAvailable(int length) const {
+    if (length < 0 || length >= this->numLengths ||
+        !this->rings[length]) {
+        return 0;
+    }
+    return this->rings[length]->size();
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+void PuzzlePool::produce(void) {
+    AllocationScope scope(ALLOC_PUZZLE_POOL);
+    this->corpusEpochs.waitForCorpus();
+    int readerSlot = this->corpusEpochs.registerReader();
+    if (NO_READER_SLOT == readerSlot) {
+        return; //Pool stays empty, the game uses the corpus directly
+    }
+    FastRandom rng(this->seed);
+    SequenceEnum::setThreadRandomSource(&rng);
+    while (this->keepProducing.load()) {
+        uint64_t takenBefore = this->puzzlesTaken.load();
+        bool producedAny = false;
+        for (int len = 0; len < this->numLengths; len++) {
+            SpscRing<Puzzle *> * ring = this->rings[len].get();
+            if (nullptr == ring || ring->size() >= ring->capacity()) {
+                continue;
+            }
+            Puzzle * puzzle = nullptr;
+            { //Only pin the corpus while drawing from it
+                EpochCorpus::ReadGuard corpus(this->corpusEpochs, readerSlot);
+                if (corpus->getNumPuzzles(len) > 0) {
+                    puzzle = makeFreshPuzzle(len, *corpus, rng);
+                }
+            }
+            if (nullptr == puzzle) {
+                continue; //No words of this length
+            }
+            if (ring->tryPush(puzzle)) {
+                producedAny = true;
+            }
+            else {
+                delete puzzle;
+            }
+        }
+        if (!producedAny) {
+            waitForTake(takenBefore); //Every ring is full (or has no words)
+        }
+    }
+    SequenceEnum::setThreadRandomSource(nullptr);
+    this->corpusEpochs.unregisterReader(readerSlot);
+}
+
+//Builds a puzzle for a word drawn from the length's alias table, retrying a
+//few times if the puzzle turns out to have more than one valid answer
+Puzzle * PuzzlePool::makeFreshPuzzle(int length, const Corpus& corpus,
+                                     FastRandom& rng) const {
+    Puzzle * puzzle = nullptr;
+    for (int attempt = 0; attempt < MAX_BUILD_ATTEMPTS; attempt++) {
+        delete puzzle; //Discard the previous ambiguous attempt
+        int index = (int) corpus.getSampler(length).draw(rng);
+        const std::string& word = corpus.getWord(length, index);
+        int variant;
+        SequenceEnum * built = PuzzleFactory::makePuzzle(word, &variant);
+        unsigned int answers =
+                AmbiguityJob::countPossibleAnswers(*built, this->dictionary);
+        built->setAmbiguityCount(answers);
+        puzzle = new Puzzle(word, *built, variant, index);
+        delete built;
+        if (answers <= ONE_VALID_ANSWER) {
+            break;
+        }
+    }
+    return puzzle;
+}
+
+//Sleeps until a puzzle has been taken since takenBefore was read, or the
+//pool is stopped
+void PuzzlePool::waitForTake(uint64_t takenBefore) {
+    std::unique_lock<std::mutex> lock(this->producerLock);
+    this->producerWaiting.store(true, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    this->producerWake.wait(lock, [this, takenBefore] {
+        return !this->keepProducing.load() ||
+               this->puzzlesTaken.load() != takenBefore;
+    });
+    this->producerWaiting.store(false, std::memory_order_relaxed);
+}
+
+void PuzzlePool::wakeProducer(void) {
+    {
+        std::lock_guard<std::mutex> guard(this->producerLock);
+    }
+    this->producerWake.notify_one();
+}
+
+void PuzzlePool::drain(void) {
+    for (std::unique_ptr<SpscRing<Puzzle *> >& ring : this->rings) {
+        Puzzle * puzzle;
+        while (ring && ring->tryPop(puzzle)) {
+            delete puzzle;
+        }
+    }
+}
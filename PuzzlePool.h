@@ -0,0 +1,118 @@
+// Author: Forrest Miller
+// Filename: PuzzlePool.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef PuzzlePool_h
+#define PuzzlePool_h
+
+#include "SequenceEnum.h"
+#include "Puzzle.h"
+#include "Corpus.h"
+#include "EpochCorpus.h"
+#include "Dictionary.h"
+#include "FastRandom.h"
+#include "SpscRing.h"
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//
+// Class Overview:
+//     This class keeps a pool of freshly generated puzzles for every word
+//     length so that each round can show the player a new encryption instead
+//     of reusing the one built at startup. A background producer thread picks
+//     words with the alias tables of the currently published corpus (it is
+//     an EpochCorpus reader like any other), builds puzzles with
+//     PuzzleFactory (using its own FastRandom, never rand()), skips puzzles
+//     with more than one valid answer, snapshots them into immutable
+//     Puzzles, and pushes them into a lock-free
+//     single-producer/single-consumer ring per length. Taking a puzzle is a
+//     constant-time pop that never waits on the producer. Once every ring
+//     is full the producer sleeps until a puzzle is taken, so an idle game
+//     costs nothing.
+//
+// Valid States include: Constructed (not producing), running (after start()),
+//                       and stopped (after stop() or destruction). Puzzles can
+//                       be taken in any state; the pool may simply be empty.
+//
+// Anticipated Use:  One pool per process, started after the corpus and alias
+//                   tables are built. The game loop calls takePuzzle() and
+//                   falls back to the startup corpus if the pool is empty.
+//
+// Class Invariants:  -Only one thread calls takePuzzle().
+//                    -Every puzzle in a ring was built from a word of that
+//                     ring's length.
+//
+// Assumptions:
+//      -The EpochCorpus and dictionary outlive the pool.
+//      -If the exchange is still empty, a corpus is published before the pool
+//       is stopped (the producer waits for the first one).
+//      -A reader slot is free for the producer thread; if not, the pool
+//       stays empty and the game always falls back to the corpus.
+//
+// Dependencies: SequenceEnum, Puzzle, PuzzleFactory, AmbiguityJob, Corpus,
+//               EpochCorpus, Dictionary, FastRandom, SpscRing
+//
+
+class PuzzlePool {
+private:
+    EpochCorpus& corpusEpochs;
+    const Dictionary& dictionary;
+    int numLengths;
+    uint64_t seed;
+    std::vector<std::unique_ptr<SpscRing<Puzzle *> > > rings;
+    std::atomic<bool> keepProducing;
+    std::thread producer;
+    std::atomic<uint64_t> puzzlesTaken;   //Written only by the consumer
+    std::atomic<bool> producerWaiting;
+    std::mutex producerLock; //Only used to put the producer to sleep
+    std::condition_variable producerWake;
+
+    void produce(void);
+    void waitForTake(uint64_t takenBefore);
+    void wakeProducer(void);
+    Puzzle * makeFreshPuzzle(int length, const Corpus&,
+                             FastRandom& rng) const;
+    void drain(void);
+public:
+    PuzzlePool(EpochCorpus&, const Dictionary&, uint64_t seed);
+    //Description: Constructs an empty pool with one ring per length. Lengths
+    //             the corpus has no puzzles for stay empty. Nothing is
+    //             produced until start() is called.
+    //Preconditions: None (the dictionary may still be being built, as long
+    //               as it is done before the first corpus is published)
+    //Postconditions: Pool is empty and not running
+
+    ~PuzzlePool(void);
+    //Description: Stops the producer and deletes any puzzles left in the pool
+
+    void start(void);
+    //Description: Starts the background producer thread
+    //Preconditions: Pool is not already running
+    //Postconditions: Pool fills in the background
+
+    void stop(void);
+    //Description: Stops the producer thread and waits for it to finish
+    //Preconditions: None
+    //Postconditions: No more puzzles will be added
+
+    Puzzle * takePuzzle(int length);
+    //Description: Pops a ready-made puzzle of the given length in constant
+    //             time, waking the producer if it is asleep. Never blocks.
+    //Preconditions: Only called from one thread
+    //Postconditions: Returns nullptr if the pool for that length is empty (or
+    //                the length is unsupported). Otherwise the caller owns the
+    //                returned puzzle and must delete it.
+
+    size_t getAvailable(int length) const;
+    //Description: Returns roughly how many puzzles of the length are ready
+    //Preconditions: None
+    //Postconditions: None, this method is const
+};
+
+#endif /* PuzzlePool_h */
@@ -0,0 +1,45 @@
+// Author: Forrest Miller
+// Filename: PuzzleView.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "PuzzleView.h"
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the PuzzleView class.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+PuzzleView::PuzzleView(const Puzzle& viewed) {
+    this->puzzle = &viewed;
+    this->encryptionIsActive = true;
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+const std::string& PuzzleView::emitWord(void) const {
+    return this->puzzle->emitWord(this->encryptionIsActive);
+}
+
+bool PuzzleView::getEncryptionIsActive(void) const {
+    return this->encryptionIsActive;
+}
+
+bool PuzzleView::toggleEncryptionActivation(void) {
+    this->encryptionIsActive = !this->encryptionIsActive;
+    return this->encryptionIsActive;
+}
+
+bool PuzzleView::guessWord(const std::string& guess) const {
+    return this->puzzle->guessWord(guess);
+}
+
+const Puzzle& PuzzleView::getPuzzle(void) const {
+    return *this->puzzle;
+}
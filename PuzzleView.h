@@ -0,0 +1,64 @@
+// Author: Forrest Miller
+// Filename: PuzzleView.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef PuzzleView_h
+#define PuzzleView_h
+
+#include "Puzzle.h"
+#include <string>
+
+//
+// Class Overview:
+//     This class is one player's view of a shared, immutable Puzzle. It holds
+//     the state that the SequenceEnum objects used to keep inside themselves:
+//     whether the modified word or the original word is currently being
+//     shown. Toggling a view never touches the Puzzle, so many sessions can
+//     look at the same Puzzle at once.
+//
+// Valid States include: Encryption on (the default) or off.
+//
+// Anticipated Use:  Created on the stack for each round of the game.
+//
+// Class Invariants:  -The view never modifies the Puzzle it points to.
+//
+// Assumptions:
+//      -The Puzzle outlives the view.
+//
+// Dependencies: Puzzle
+//
+
+class PuzzleView {
+private:
+    const Puzzle * puzzle;
+    bool encryptionIsActive;
+public:
+    PuzzleView(const Puzzle&);
+    //Description: Constructs a view of the puzzle with encryption turned on
+    //Preconditions: The puzzle must outlive the view
+    //Postconditions: emitWord() returns the modified word
+
+    const std::string& emitWord(void) const;
+    //Description: Returns the modified or original word depending on whether
+    //             encryption is active in this view
+    //Preconditions: None
+    //Postconditions: None, this method is const
+
+    bool getEncryptionIsActive(void) const;
+    //Description: Returns the state of the view
+
+    bool toggleEncryptionActivation(void);
+    //Description: Switches between showing the modified and original word
+    //Preconditions: None
+    //Postconditions: Returns the new state. The Puzzle is untouched.
+
+    bool guessWord(const std::string&) const;
+    //Description: Returns true if the guess is the original word (case
+    //             insensitive)
+
+    const Puzzle& getPuzzle(void) const;
+    //Description: Returns the puzzle being viewed
+};
+
+#endif /* PuzzleView_h */
@@ -0,0 +1,220 @@
+// Author: Forrest Miller
+// Filename: RecordPipeline.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "RecordPipeline.h"
+#include "FastRandom.h"
+#include "SequenceEnum.h"
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <thread>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the RecordPipeline
+//          class. A null batch pointer marks the end of the input: the reader
+//          sends one to every worker, each worker passes it on to the writer,
+//          and the writer stops at the first one it meets in turn order (by
+//          then every real batch has been written).
+//          A stage with nothing to do spins briefly, then yields, then naps,
+//          so an idle stage costs little while a busy one never sleeps.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const size_t RECORDS_PER_BATCH = 4096;
+const unsigned int BATCHES_PER_WORKER = 4; //In flight at once
+const unsigned int SPINS_BEFORE_YIELD = 64;
+const unsigned int YIELDS_BEFORE_NAP = 128;
+const std::chrono::microseconds STAGE_IDLE_NAP(50);
+
+//Waits a little longer each time a stage finds nothing to do
+static void waitForWork(unsigned int& idleRounds) {
+    idleRounds++;
+    if (idleRounds < SPINS_BEFORE_YIELD) {
+        return;
+    }
+    if (idleRounds < SPINS_BEFORE_YIELD + YIELDS_BEFORE_NAP) {
+        std::this_thread::yield();
+        return;
+    }
+    std::this_thread::sleep_for(STAGE_IDLE_NAP);
+}
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+RecordPipeline::RecordPipeline(const RecordProcessor& recordProcessor,
+                               unsigned int workerCount, uint64_t randomSeed)
+: processor(recordProcessor) {
+    if (0u == workerCount) {
+        workerCount = std::thread::hardware_concurrency();
+    }
+    if (0u == workerCount) {
+        workerCount = 1u;
+    }
+    this->workers = workerCount;
+    this->seed = randomSeed;
+    this->writeFailed.store(false);
+    size_t batchCount = (size_t) this->workers * BATCHES_PER_WORKER;
+    this->freeBatches.reset(new BatchRing(batchCount));
+    for (size_t i = 0; i < batchCount; i++) {
+        this->batches.emplace_back(new RecordBatch());
+        this->batches.back()->recordEnds.reserve(RECORDS_PER_BATCH);
+        this->freeBatches->tryPush(this->batches.back().get());
+    }
+    for (unsigned int i = 0; i < this->workers; i++) {
+        //Room for every batch plus the end marker, so pushes never fail
+        this->toWork.emplace_back(new BatchRing(batchCount + 1));
+        this->toWrite.emplace_back(new BatchRing(batchCount + 1));
+    }
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+bool RecordPipeline::run(WordReader& records, int outputFd,
+                         BatchTally& tally) {
+    uint64_t seeds = this->seed;
+    this->writeFailed.store(false);
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < this->workers; i++) {
+        threads.emplace_back(&RecordPipeline::work, this, i,
+                             FastRandom::splitMix(seeds));
+    }
+    std::thread writer(&RecordPipeline::write, this, outputFd,
+                       std::ref(tally));
+
+    unsigned long sequence = 0ul;
+    bool moreRecords = true;
+    RecordBatch * unused = nullptr; //Last batch, if the input ran out first
+    while (moreRecords && !this->writeFailed.load(std::memory_order_relaxed)) {
+        RecordBatch * batch;
+        unsigned int idleRounds = 0u;
+        while (!this->freeBatches->tryPop(batch)) {
+            waitForWork(idleRounds); //Backpressure from the writer
+        }
+        moreRecords = fillBatch(records, *batch);
+        if (batch->recordEnds.empty()) {
+            unused = batch; //The writer is the only one pushing free batches
+            continue;
+        }
+        this->toWork[sequence % this->workers]->tryPush(batch);
+        sequence++;
+    }
+    for (unsigned int i = 0; i < this->workers; i++) {
+        this->toWork[(sequence + i) % this->workers]->tryPush(nullptr);
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+    writer.join();
+    if (nullptr != unused) {
+        this->freeBatches->tryPush(unused); //Every other thread has finished
+    }
+    if (records.hadError()) {
+        std::cerr << "The input ended in the middle of a record" << std::endl;
+    }
+    return !this->writeFailed.load() && !records.hadError();
+}
+
+unsigned int RecordPipeline::getWorkers(void) const {
+    return this->workers;
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+
+//Copies up to RECORDS_PER_BATCH non-blank records into the batch. Returns
+//false once the reader has no more records.
+bool RecordPipeline::fillBatch(WordReader& records,
+                               RecordBatch& batch) const {
+    batch.records.clear();
+    batch.recordEnds.clear();
+    const char * record;
+    size_t length;
+    while (batch.recordEnds.size() < RECORDS_PER_BATCH) {
+        if (!records.nextWord(record, length)) {
+            return false;
+        }
+        if (length > 0u) {
+            batch.records.append(record, length);
+            batch.recordEnds.push_back(batch.records.length());
+        }
+    }
+    return true;
+}
+
+void RecordPipeline::work(unsigned int index, uint64_t workerSeed) {
+    FastRandom rng(workerSeed);
+    SequenceEnum::setThreadRandomSource(&rng);
+    BatchRing& input = *this->toWork[index];
+    BatchRing& output = *this->toWrite[index];
+    while (true) {
+        RecordBatch * batch;
+        unsigned int idleRounds = 0u;
+        while (!input.tryPop(batch)) {
+            waitForWork(idleRounds);
+        }
+        if (nullptr == batch) {
+            output.tryPush(nullptr);
+            break;
+        }
+        for (int i = 0; i < MAX_RECORD_OUTCOMES; i++) {
+            batch->outcomes[i] = 0ul;
+        }
+        size_t start = 0u;
+        for (size_t end : batch->recordEnds) {
+            int outcome =
+            this->processor.appendRecord(batch->records.data() + start,
+                                         end - start, batch->output);
+            batch->outcomes[outcome]++;
+            start = end;
+        }
+        output.tryPush(batch);
+    }
+    SequenceEnum::setThreadRandomSource(nullptr);
+}
+
+void RecordPipeline::write(int outputFd, BatchTally& tally) {
+    RecordProcessor::clearTally(tally);
+    unsigned long sequence = 0ul;
+    while (true) {
+        RecordBatch * batch;
+        unsigned int idleRounds = 0u;
+        while (!this->toWrite[sequence % this->workers]->tryPop(batch)) {
+            waitForWork(idleRounds);
+        }
+        if (nullptr == batch) {
+            break;
+        }
+        sequence++;
+        for (int i = 0; i < MAX_RECORD_OUTCOMES; i++) {
+            tally.outcomes[i] += batch->outcomes[i];
+        }
+        tally.outputBytes += batch->output.length();
+        if (this->writeFailed.load(std::memory_order_relaxed)) {
+            batch->output.clear(); //Keep the batches moving until the end
+        }
+        else if (!RecordProcessor::writeAll(batch->output, outputFd)) {
+            this->writeFailed.store(true);
+        }
+        this->freeBatches->tryPush(batch);
+    }
+    //Every other worker's end marker comes after all of its batches, so they
+    //are next in their rings. Taking them leaves the rings empty for the
+    //next run.
+    for (unsigned int i = 1u; i < this->workers; i++) {
+        RecordBatch * marker;
+        unsigned int idleRounds = 0u;
+        while (!this->toWrite[(sequence + i) % this->workers]->tryPop(marker)) {
+            waitForWork(idleRounds);
+        }
+    }
+}
@@ -0,0 +1,100 @@
+// Author: Forrest Miller
+// Filename: RecordPipeline.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef RecordPipeline_h
+#define RecordPipeline_h
+
+#include "RecordProcessor.h"
+#include "WordReader.h"
+#include "OutputBuffer.h"
+#include "SpscRing.h"
+#include <atomic>
+#include <memory>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+//
+// Class Overview:
+//     This class runs a RecordProcessor (encrypting a word list, grading a
+//     log of guesses) as a pipeline, so reading, processing and writing all
+//     happen at once instead of one after the other:
+//        reader (calling thread) -> N workers -> writer
+//     The reader copies records into batches of a few thousand and deals
+//     them to the workers in turn; each worker processes its batches with
+//     its own FastRandom; the writer takes the finished batches back from the
+//     workers in the same turn order, which puts the output back in input
+//     order without having to sort anything. Every hand-off goes through an
+//     SpscRing, so no stage ever takes a lock.
+//     A fixed set of batches circulates: the writer hands each one back to
+//     the reader once it is written, and the reader waits when none are free.
+//     Memory use is therefore set by the thread count alone, however long the
+//     input is, and a slow disk holds the whole pipeline back instead of
+//     letting finished output pile up.
+//
+// Valid States include: The class holds its settings and the batches between
+//                       runs.
+//
+// Anticipated Use:  Run from main() with --encrypt or --grade and more than
+//                   one thread.
+//
+// Class Invariants:  -Batch k is handled by worker k % workers.
+//                    -Every batch is always in exactly one ring or held by
+//                     exactly one stage.
+//
+// Assumptions:
+//      -The processor only reads its settings while processing, so the
+//       workers can share it.
+//
+// Dependencies: RecordProcessor, WordReader, OutputBuffer, SpscRing,
+//               FastRandom, SequenceEnum
+//
+
+class RecordPipeline {
+private:
+    struct RecordBatch {
+        std::string records;               //The batch's records back to back
+        std::vector<size_t> recordEnds;    //Where each record ends
+        OutputBuffer output;
+        unsigned long outcomes[MAX_RECORD_OUTCOMES];
+    };
+    typedef SpscRing<RecordBatch *> BatchRing;
+
+    const RecordProcessor& processor;
+    unsigned int workers;
+    uint64_t seed;
+    std::vector<std::unique_ptr<RecordBatch> > batches;
+    std::unique_ptr<BatchRing> freeBatches;         //Writer -> reader
+    std::vector<std::unique_ptr<BatchRing> > toWork;  //Reader -> worker i
+    std::vector<std::unique_ptr<BatchRing> > toWrite; //Worker i -> writer
+    std::atomic<bool> writeFailed;
+
+    bool fillBatch(WordReader& records, RecordBatch& batch) const;
+    void work(unsigned int index, uint64_t workerSeed);
+    void write(int outputFd, BatchTally& tally);
+
+    RecordPipeline(const RecordPipeline&);
+    RecordPipeline& operator=(const RecordPipeline&);
+public:
+    RecordPipeline(const RecordProcessor&, unsigned int workers,
+                   uint64_t seed);
+    //Description: Constructs a pipeline with 'workers' processing threads
+    //             (0 meaning one per hardware thread), whose random sources
+    //             are seeded from 'seed'
+    //Preconditions: The processor outlives the pipeline
+    //Postconditions: All batches are free
+
+    bool run(WordReader& records, int outputFd, BatchTally& tally);
+    //Description: Processes every record from the reader and writes the
+    //             output, in input order, to the descriptor
+    //Preconditions: The reader is open
+    //Postconditions: All threads have finished. Returns false if reading or
+    //                writing failed part way.
+
+    unsigned int getWorkers(void) const;
+    //Description: Returns the number of processing threads
+};
+
+#endif /* RecordPipeline_h */
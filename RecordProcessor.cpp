@@ -0,0 +1,81 @@
+// Author: Forrest Miller
+// Filename: RecordProcessor.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "RecordProcessor.h"
+#include "FastRandom.h"
+#include "SequenceEnum.h"
+#include <errno.h>
+#include <iostream>
+#include <string.h>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the
+//          RecordProcessor class. Output lines are copied into the
+//          OutputBuffer's scratch area, where each lands right behind the one
+//          before, so a whole megabyte of them goes out as a single iovec.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const size_t OUTPUT_FLUSH_BYTES = 1u << 20; //Write once this much is pending
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+RecordProcessor::~RecordProcessor(void) {
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+bool RecordProcessor::run(WordReader& records, int outputFd,
+                          BatchTally& tally, uint64_t seed) const {
+    FastRandom rng(seed);
+    SequenceEnum::setThreadRandomSource(&rng);
+    OutputBuffer out;
+    clearTally(tally);
+    bool written = true;
+    const char * record;
+    size_t length;
+    while (written && records.nextWord(record, length)) {
+        if (0u == length) {
+            continue;
+        }
+        tally.outcomes[appendRecord(record, length, out)]++;
+        if (out.length() >= OUTPUT_FLUSH_BYTES) {
+            tally.outputBytes += out.length();
+            written = writeAll(out, outputFd);
+        }
+    }
+    tally.outputBytes += out.length();
+    written = written && writeAll(out, outputFd);
+    SequenceEnum::setThreadRandomSource(nullptr);
+    if (records.hadError()) {
+        std::cerr << "The input ended in the middle of a record" << std::endl;
+    }
+    return written && !records.hadError();
+}
+
+bool RecordProcessor::writeAll(OutputBuffer& out, int outputFd) {
+    while (!out.empty()) {
+        if (out.writeTo(outputFd) < 0 && EINTR != errno) {
+            std::cerr << "write: " << strerror(errno) << std::endl;
+            out.clear();
+            return false;
+        }
+    }
+    return true;
+}
+
+void RecordProcessor::clearTally(BatchTally& tally) {
+    for (int i = 0; i < MAX_RECORD_OUTCOMES; i++) {
+        tally.outcomes[i] = 0ul;
+    }
+    tally.outputBytes = 0ul;
+}
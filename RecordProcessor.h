@@ -0,0 +1,76 @@
+// Author: Forrest Miller
+// Filename: RecordProcessor.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef RecordProcessor_h
+#define RecordProcessor_h
+
+#include "WordReader.h"
+#include "OutputBuffer.h"
+#include <ostream>
+#include <stdint.h>
+
+//
+// Class Overview:
+//     This abstract class is one line-at-a-time batch job: it turns each
+//     input record (a word, or a line of a log) into one output line and
+//     says which of a few outcomes the record had, so a run can be counted
+//     up. Subclasses only say how one record is handled; reading the input,
+//     gathering the output into large writes and counting outcomes are done
+//     here for a single thread, and by RecordPipeline across many.
+//
+// Valid States include: Subclasses hold only read-only settings.
+//
+// Anticipated Use:  Subclassed by BatchEncryptor and GuessGrader.
+//
+// Class Invariants:  -appendRecord() can be called from many threads at once.
+//                    -Output lines come out in the same order as the records.
+//
+// Assumptions:
+//      -Blank input lines are not records and are ignored.
+//
+// Dependencies: WordReader, OutputBuffer, FastRandom, SequenceEnum
+//
+
+const int MAX_RECORD_OUTCOMES = 4;
+
+struct BatchTally {
+    unsigned long outcomes[MAX_RECORD_OUTCOMES]; //Records per outcome
+    unsigned long outputBytes;
+};
+
+class RecordProcessor {
+public:
+    virtual ~RecordProcessor(void);
+
+    virtual int appendRecord(const char * record, size_t length,
+                             OutputBuffer& out) const = 0;
+    //Description: Handles one record, appending any output for it, and
+    //             returns its outcome. Random numbers come from the calling
+    //             thread's SequenceEnum source.
+    //Preconditions: length is greater than 0
+    //Postconditions: Returns a value from 0 to MAX_RECORD_OUTCOMES - 1
+
+    virtual void report(const BatchTally& tally, double seconds,
+                        std::ostream& out) const = 0;
+    //Description: Prints the counts and throughput of a run
+
+    bool run(WordReader& records, int outputFd, BatchTally& tally,
+             uint64_t seed) const;
+    //Description: Handles every record from the reader on the calling
+    //             thread and writes the output to the descriptor. The thread
+    //             draws random numbers from a FastRandom seeded with 'seed'.
+    //Preconditions: The reader is open
+    //Postconditions: Returns false if reading or writing failed part way
+
+    static bool writeAll(OutputBuffer& out, int outputFd);
+    //Description: Writes all of the pending output, retrying partial writes
+    //Preconditions: None
+    //Postconditions: Returns false (after printing why) on a write error
+
+    static void clearTally(BatchTally& tally);
+    //Description: Zeroes every count
+};
+
+#endif /* RecordProcessor_h */
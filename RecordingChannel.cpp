@@ -0,0 +1,45 @@
+// Author: Forrest Miller
+// Filename: RecordingChannel.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "RecordingChannel.h"
+#include <iostream>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the
+//          RecordingChannel class.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+RecordingChannel::RecordingChannel(SessionRecording& into)
+: recording(into) {
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+void RecordingChannel::flush(void) {
+    this->recording.addOutput(getOutput().toString());
+    TerminalChannel::flush();
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+bool RecordingChannel::readMore(void) {
+    std::string line;
+    if (std::getline(std::cin, line)) {
+        this->recording.addLine(line);
+        pushLine(line);
+    }
+    else {
+        close();
+    }
+    return true;
+}
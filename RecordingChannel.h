@@ -0,0 +1,48 @@
+// Author: Forrest Miller
+// Filename: RecordingChannel.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef RecordingChannel_h
+#define RecordingChannel_h
+
+#include "TerminalChannel.h"
+#include "SessionRecording.h"
+
+//
+// Class Overview:
+//     This class plays a game on the terminal like TerminalChannel, and also
+//     writes it down: every line read from std::cin is added to a
+//     SessionRecording, and every piece of output is added to its transcript
+//     hash just before it is written.
+//
+// Valid States include: Those of TerminalChannel
+//
+// Anticipated Use:  The game played with --record.
+//
+// Class Invariants:  -The recording holds exactly the lines handed to the
+//                     game, in order.
+//
+// Assumptions:
+//      -The recording outlives the channel.
+//
+// Dependencies: TerminalChannel, SessionRecording
+//
+
+class RecordingChannel : public TerminalChannel {
+private:
+    SessionRecording& recording;
+protected:
+    bool readMore(void) override;
+    //Description: Blocks for the next line of std::cin and records it,
+    //             closing the channel at end of file
+public:
+    explicit RecordingChannel(SessionRecording& recording);
+    //Description: Constructs a channel that records into the recording
+
+    void flush(void) override;
+    //Description: Adds the pending output to the transcript hash, then
+    //             writes it to standard output
+};
+
+#endif /* RecordingChannel_h */
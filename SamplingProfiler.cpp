@@ -0,0 +1,381 @@
+// Author: Forrest Miller
+// Filename: SamplingProfiler.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "SamplingProfiler.h"
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cxxabi.h>
+#include <dlfcn.h>
+#include <errno.h>
+#include <execinfo.h>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <mutex>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <thread>
+#include <vector>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the
+//          SamplingProfiler class. The ring works like a sequence lock: a
+//          sample's handler claims ticket t, marks the slot 2t + 1 while it
+//          writes the stack and 2t + 2 once it is done. The folding thread
+//          takes ticket t only if the slot reads 2t + 2 both before and after
+//          it copies the stack; a slot already reused by a later lap means the
+//          sample was overwritten, and counts as dropped. Stacks are kept as
+//          raw addresses while profiling and only named at stop(), so the
+//          folding thread never calls into the dynamic linker.
+//          Pausing is a flag the handler checks; the folding thread then
+//          disarms the timer (and rearms it on resume), since the signal
+//          handler for SIGUSR2 can't safely set it.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const uint64_t PROFILE_RING_SAMPLES = 4096u;
+const std::chrono::milliseconds PROFILE_FOLD_INTERVAL(50);
+const int SIGNAL_FRAMES = 2;          //The handler and the signal trampoline
+const long MICROS_PER_PROFILE_SECOND = 1000000l;
+const int PROFILE_LINE_BYTES = 128;
+const char * const AREA_NAMES[] = {"SequenceEnum.cpp", "SeqExtract.cpp",
+    "SpasEnum.cpp", "I/O", "session handling", "corpus", "other"};
+
+//Where a function's name starts decides its area
+const char * const SEQUENCE_ENUM_PREFIXES[] = {"SequenceEnum::"};
+const char * const SEQ_EXTRACT_PREFIXES[] = {"SeqExtract::"};
+const char * const SPAS_ENUM_PREFIXES[] = {"SpasEnum::"};
+const char * const IO_PREFIXES[] = {"OutputBuffer::", "TerminalChannel::",
+    "RecordingChannel::", "WordReader::", "EventLog::", "std::getline",
+    "std::basic_istream", "std::basic_ostream", "std::basic_filebuf",
+    "std::__ostream_insert"};
+const char * const SESSION_PREFIXES[] = {"GameSession::", "GameServer::",
+    "GameChannel::", "ScriptedChannel::", "Puzzle::", "PuzzleView::",
+    "PuzzlePool::", "BotPlayer::", "LoadGenerator::", "GuessGrader::",
+    "StatsShard::", "SessionReplayer::"};
+const char * const CORPUS_PREFIXES[] = {"Corpus::", "EpochCorpus::",
+    "AmbiguityJob::", "Dictionary::", "AliasSampler::", "PuzzleFactory::"};
+//The system calls (by their names and glibc's aliases) that move data
+const char * const IO_CALLS[] = {"read", "write", "readv", "writev", "recv",
+    "send", "recvfrom", "sendto", "recvmsg", "sendmsg", "accept", "accept4",
+    "epoll_wait", "poll", "__read", "__write", "__writev", "__libc_read",
+    "__libc_write", "__libc_writev", "__libc_recv", "__libc_send"};
+
+struct ProfileSample {
+    std::atomic<uint64_t> sequence; //2t + 1 while ticket t writes, then 2t + 2
+    int depth;
+    void * frames[MAX_PROFILE_DEPTH]; //Innermost first
+};
+
+static ProfileSample ring[PROFILE_RING_SAMPLES];
+static std::atomic<uint64_t> ringHead(0u);
+static std::atomic<bool> samplingWanted(false);
+static bool profiling = false;
+
+//Only touched by the folding thread, or by stop() once it has finished
+static uint64_t ringTail = 0u;
+static uint64_t droppedSamples = 0u;
+static bool timerArmed = false;
+static std::map<std::vector<void *>, uint64_t> stackCounts;
+
+static int sampleHz = DEFAULT_PROFILE_HZ;
+static std::string foldedPath;
+static std::ofstream foldedFile;
+static std::thread folder;
+static std::mutex folderLock; //Only used to put the folder to sleep
+static std::condition_variable folderWake;
+static bool stopRequested = false;
+
+//Captures the interrupted thread's stack. Only touches the stack, the ring
+//and errno (which backtrace() may change, and is put back).
+static void onProfileSignal(int) {
+    if (!samplingWanted.load(std::memory_order_relaxed)) {
+        return;
+    }
+    int savedErrno = errno;
+    void * frames[MAX_PROFILE_DEPTH + SIGNAL_FRAMES];
+    int depth = backtrace(frames, MAX_PROFILE_DEPTH + SIGNAL_FRAMES) -
+                SIGNAL_FRAMES;
+    if (depth > 0) {
+        uint64_t ticket = ringHead.fetch_add(1u, std::memory_order_relaxed);
+        ProfileSample& slot = ring[ticket % PROFILE_RING_SAMPLES];
+        slot.sequence.store(2u * ticket + 1u, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.depth = depth;
+        memcpy(slot.frames, frames + SIGNAL_FRAMES,
+               (size_t) depth * sizeof(void *));
+        slot.sequence.store(2u * ticket + 2u, std::memory_order_release);
+    }
+    errno = savedErrno;
+}
+
+static void onToggleSignal(int) {
+    SamplingProfiler::setSampling(!SamplingProfiler::isSampling());
+}
+
+static bool setTimer(bool on) {
+    itimerval timer;
+    memset(&timer, 0, sizeof(timer));
+    if (on) {
+        long micros = MICROS_PER_PROFILE_SECOND / sampleHz;
+        timer.it_interval.tv_sec = micros / MICROS_PER_PROFILE_SECOND;
+        timer.it_interval.tv_usec = micros % MICROS_PER_PROFILE_SECOND;
+        timer.it_value = timer.it_interval;
+    }
+    return 0 == setitimer(ITIMER_PROF, &timer, nullptr);
+}
+
+//Counts every finished sample in the ring. Stops at one still being written,
+//to be picked up next time.
+static void foldRing(void) {
+    uint64_t head = ringHead.load(std::memory_order_acquire);
+    if (head - ringTail > PROFILE_RING_SAMPLES) { //Lapped while we slept
+        droppedSamples += head - ringTail - PROFILE_RING_SAMPLES;
+        ringTail = head - PROFILE_RING_SAMPLES;
+    }
+    std::vector<void *> stack;
+    for (; ringTail < head; ringTail++) {
+        ProfileSample& slot = ring[ringTail % PROFILE_RING_SAMPLES];
+        uint64_t finished = 2u * ringTail + 2u;
+        uint64_t before = slot.sequence.load(std::memory_order_acquire);
+        if (before < finished) {
+            break;
+        }
+        int depth = std::min(std::max(slot.depth, 0), MAX_PROFILE_DEPTH);
+        stack.assign(slot.frames, slot.frames + depth);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (before != finished ||
+            slot.sequence.load(std::memory_order_relaxed) != finished) {
+            droppedSamples++; //Overwritten by a later sample
+            continue;
+        }
+        stackCounts[stack]++;
+    }
+}
+
+static void foldLoop(void) {
+    std::unique_lock<std::mutex> lock(folderLock);
+    while (!stopRequested) {
+        folderWake.wait_for(lock, PROFILE_FOLD_INTERVAL);
+        lock.unlock();
+        bool wanted = samplingWanted.load();
+        if (wanted != timerArmed && setTimer(wanted)) {
+            timerArmed = wanted;
+        }
+        foldRing();
+        lock.lock();
+    }
+}
+
+//Drops the parameter list from a demangled name, so each function is one
+//frame however it was called ("A::f(int) const" becomes "A::f")
+static std::string withoutParameters(const std::string& name) {
+    size_t close = name.rfind(')');
+    if (std::string::npos == close) {
+        return name;
+    }
+    int depth = 0;
+    for (size_t i = close + 1u; i-- > 0u; ) {
+        if (')' == name[i]) {
+            depth++;
+        }
+        else if ('(' == name[i] && 0 == --depth) {
+            return name.substr(0u, i);
+        }
+    }
+    return name;
+}
+
+//Names the function holding the address. Return addresses point just past
+//their call, so callers are looked up one byte back.
+static std::string functionName(void * address, bool caller) {
+    char * at = (char *) address - (caller ? 1 : 0);
+    Dl_info info;
+    if (0 == dladdr(at, &info)) {
+        return "[unknown]";
+    }
+    std::string name;
+    if (nullptr != info.dli_sname) {
+        int status = 0;
+        char * demangled = abi::__cxa_demangle(info.dli_sname, nullptr,
+                                               nullptr, &status);
+        name = withoutParameters((0 == status && nullptr != demangled) ?
+                                 demangled : info.dli_sname);
+        free(demangled);
+    }
+    else { //Not exported: name it by its place in its file
+        const char * file = (nullptr == info.dli_fname) ? "?" :
+        info.dli_fname;
+        const char * slash = strrchr(file, '/');
+        char offset[PROFILE_LINE_BYTES];
+        snprintf(offset, sizeof(offset), "+0x%lx",
+                 (unsigned long) (at - (char *) info.dli_fbase));
+        name = std::string((nullptr == slash) ? file : slash + 1) + offset;
+    }
+    std::replace(name.begin(), name.end(), ';', ':'); //Frames' separator
+    return name;
+}
+
+static bool startsWithAny(const std::string& name,
+                          const char * const * prefixes, size_t count) {
+    for (size_t i = 0u; i < count; i++) {
+        if (0 == name.compare(0u, strlen(prefixes[i]), prefixes[i])) {
+            return true;
+        }
+    }
+    return false;
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+bool SamplingProfiler::start(const std::string& path, int hz) {
+    if (hz < 1 || hz > MAX_PROFILE_HZ) {
+        std::cerr << "Profiling rate " << hz << " Hz is outside 1 to "
+        << MAX_PROFILE_HZ << " Hz" << std::endl;
+        return false;
+    }
+    foldedFile.open(path, std::ios::out | std::ios::trunc);
+    if (!foldedFile) {
+        std::cerr << "Could not write the profile to " << path << std::endl;
+        return false;
+    }
+    foldedPath = path;
+    sampleHz = hz;
+    void * warmUp[SIGNAL_FRAMES];
+    backtrace(warmUp, SIGNAL_FRAMES); //Loads the unwinder now
+    struct sigaction action;
+    memset(&action, 0, sizeof(action));
+    sigemptyset(&action.sa_mask);
+    action.sa_flags = SA_RESTART;
+    action.sa_handler = onProfileSignal;
+    sigaction(SIGPROF, &action, nullptr);
+    action.sa_handler = onToggleSignal;
+    sigaction(SIGUSR2, &action, nullptr);
+    if (!setTimer(true)) {
+        std::cerr << "Could not start the profiling timer: "
+        << strerror(errno) << std::endl;
+        return false;
+    }
+    timerArmed = true;
+    samplingWanted.store(true);
+    profiling = true;
+    stopRequested = false;
+    folder = std::thread(foldLoop);
+    return true;
+}
+
+void SamplingProfiler::stop(void) {
+    if (!profiling) {
+        return;
+    }
+    profiling = false;
+    samplingWanted.store(false);
+    {
+        std::lock_guard<std::mutex> lock(folderLock);
+        stopRequested = true;
+    }
+    folderWake.notify_one();
+    folder.join();
+    setTimer(false);
+    signal(SIGPROF, SIG_IGN); //Any still on its way
+    foldRing();
+    //Name every frame, merging the stacks that name the same functions
+    std::map<void *, std::string> names;
+    std::map<std::string, uint64_t> folded;
+    uint64_t byArea[NUM_PROFILE_AREAS] = {0u};
+    uint64_t total = 0u;
+    for (const auto& counted : stackCounts) {
+        const std::vector<void *>& stack = counted.first;
+        std::string line;
+        int area = PROFILE_OTHER;
+        for (size_t i = stack.size(); i-- > 0u; ) { //Outermost first
+            std::string& name = names[stack[i]];
+            if (name.empty()) {
+                name = functionName(stack[i], i > 0u);
+            }
+            line += (line.empty() ? "" : ";") + name;
+        }
+        for (size_t i = 0u; i < stack.size() && PROFILE_OTHER == area; i++) {
+            area = classifyFrame(names[stack[i]]);
+        }
+        folded[line] += counted.second;
+        byArea[area] += counted.second;
+        total += counted.second;
+    }
+    for (const auto& stack : folded) {
+        foldedFile << stack.first << ' ' << stack.second << '\n';
+    }
+    foldedFile.close();
+    std::cerr << "Profiled " << total << " samples at " << sampleHz
+    << " Hz (" << droppedSamples << " dropped); folded stacks written to "
+    << foldedPath << "\nWhere the time went       Samples   Percent\n";
+    char line[PROFILE_LINE_BYTES];
+    for (int area = 0; area < NUM_PROFILE_AREAS; area++) {
+        snprintf(line, sizeof(line), "%-22s %11llu %8.1f%%\n",
+                 AREA_NAMES[area], (unsigned long long) byArea[area],
+                 (0u == total) ? 0.0 :
+                 100.0 * (double) byArea[area] / (double) total);
+        std::cerr << line;
+    }
+    std::cerr.flush();
+}
+
+void SamplingProfiler::setSampling(bool on) {
+    samplingWanted.store(on);
+}
+
+bool SamplingProfiler::isSampling(void) {
+    return samplingWanted.load();
+}
+
+int SamplingProfiler::classifyFrame(const std::string& function) {
+    if (startsWithAny(function, SEQUENCE_ENUM_PREFIXES,
+                      std::size(SEQUENCE_ENUM_PREFIXES))) {
+        return PROFILE_SEQUENCE_ENUM;
+    }
+    if (startsWithAny(function, SEQ_EXTRACT_PREFIXES,
+                      std::size(SEQ_EXTRACT_PREFIXES))) {
+        return PROFILE_SEQ_EXTRACT;
+    }
+    if (startsWithAny(function, SPAS_ENUM_PREFIXES,
+                      std::size(SPAS_ENUM_PREFIXES))) {
+        return PROFILE_SPAS_ENUM;
+    }
+    if (startsWithAny(function, IO_PREFIXES, std::size(IO_PREFIXES))) {
+        return PROFILE_IO;
+    }
+    for (const char * call : IO_CALLS) {
+        if (function == call) {
+            return PROFILE_IO;
+        }
+    }
+    if (startsWithAny(function, SESSION_PREFIXES,
+                      std::size(SESSION_PREFIXES))) {
+        return PROFILE_SESSION;
+    }
+    if (startsWithAny(function, CORPUS_PREFIXES,
+                      std::size(CORPUS_PREFIXES))) {
+        return PROFILE_CORPUS;
+    }
+    return PROFILE_OTHER;
+}
+
+const char * SamplingProfiler::areaName(int area) {
+    if (area < 0 || area >= NUM_PROFILE_AREAS) {
+        return AREA_NAMES[PROFILE_OTHER];
+    }
+    return AREA_NAMES[area];
+}
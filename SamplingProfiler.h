@@ -0,0 +1,101 @@
+// Author: Forrest Miller
+// Filename: SamplingProfiler.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef SamplingProfiler_h
+#define SamplingProfiler_h
+
+#include <stdint.h>
+#include <string>
+
+//
+// Class Overview:
+//     This class is a sampling profiler built into the game, for finding
+//     where a long-running server spends its time without attaching anything
+//     to the process. An interval timer sends SIGPROF every 1/hz of CPU time
+//     the process uses, and the handler captures the stack of whichever
+//     thread was running into a fixed ring of samples, claiming its slot
+//     with one atomic add (no lock and no allocation, so it is safe at any
+//     point a signal can land). A background thread folds the ring into a
+//     count per distinct stack. SIGUSR2 pauses and resumes sampling while
+//     the program runs.
+//     At stop() the stacks are written as folded stacks (one line of
+//     "outer;...;inner count" per stack), which flamegraph.pl and speedscope
+//     draw as flame graphs, and a summary of where the time went is printed:
+//     each sample is charged to the innermost frame on its stack that falls
+//     in one of
+//        -SequenceEnum.cpp, SeqExtract.cpp or SpasEnum.cpp (the transforms)
+//        -I/O (reading and writing the terminal, sockets and files)
+//        -session handling (the game, its channels, the server and the pool)
+//        -the corpus (building it, the dictionary, selection)
+//     and to "other" if none does.
+//
+// Valid States include: Stopped (the default), or started (sampling or
+//                       paused) between start() and stop().
+//
+// Anticipated Use:  main() calls start() once with --profile and stop() at
+//                   shutdown. `kill -USR2 <pid>` toggles sampling.
+//
+// Class Invariants:  -Only the folding thread (or stop(), once it has
+//                     finished) reads the ring.
+//
+// Assumptions:
+//      -Functions are named by dladdr(), so the program must be linked with
+//       -rdynamic for its own functions to show by name (the Makefile's
+//       plain build is; the PGO build isn't, so that LTO can internalize);
+//       static and inlined functions are charged to their caller.
+//      -The stack is walked with backtrace(), which is called once by
+//       start() so that the unwinder is loaded before any signal arrives;
+//       after that it only reads the stack and the unwind tables.
+//      -Nothing else in the program uses SIGPROF, SIGUSR2 or ITIMER_PROF.
+//      -start() and stop() are called from the same thread, once each.
+//
+// Dependencies: None
+//
+
+const int DEFAULT_PROFILE_HZ = 199; //Prime, so it doesn't beat with timers
+const int MAX_PROFILE_HZ = 1000;    //The timer fires at most once a kernel
+                                    //tick (CONFIG_HZ, 1000 at most)
+const int MAX_PROFILE_DEPTH = 48;   //Frames kept per sample
+
+const int PROFILE_SEQUENCE_ENUM = 0;    //Where a sample's time is charged
+const int PROFILE_SEQ_EXTRACT = 1;
+const int PROFILE_SPAS_ENUM = 2;
+const int PROFILE_IO = 3;
+const int PROFILE_SESSION = 4;
+const int PROFILE_CORPUS = 5;
+const int PROFILE_OTHER = 6;
+const int NUM_PROFILE_AREAS = 7;
+
+class SamplingProfiler {
+public:
+    static bool start(const std::string& path, int hz);
+    //Description: Starts sampling every 1/hz seconds of CPU time, with the
+    //             folded stacks to be written to the file at stop()
+    //Preconditions: Not already started
+    //Postconditions: Returns false (after printing why) if hz isn't from 1
+    //                to MAX_PROFILE_HZ, the file can't be written or the
+    //                timer can't be set
+
+    static void stop(void);
+    //Description: Stops sampling, writes the folded stacks and prints where
+    //             the time went to std::cerr
+    //Preconditions: None (does nothing if not started)
+
+    static void setSampling(bool on);
+    //Description: Pauses or resumes sampling. Safe from a signal handler.
+    //Preconditions: Started
+
+    static bool isSampling(void);
+    //Description: Returns true while started and not paused
+
+    static int classifyFrame(const std::string& function);
+    //Description: Returns the PROFILE_ area a function's time belongs to,
+    //             or PROFILE_OTHER
+
+    static const char * areaName(int area);
+    //Description: Returns the name the summary uses for a PROFILE_ area
+};
+
+#endif /* SamplingProfiler_h */
@@ -0,0 +1,35 @@
+// Author: Forrest Miller
+// Filename: ScriptedChannel.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "ScriptedChannel.h"
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the ScriptedChannel
+//          class.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+ScriptedChannel::ScriptedChannel(const std::vector<std::string>& script) {
+    for (const std::string& line : script) {
+        pushLine(line);
+    }
+    close();
+}
+
+ScriptedChannel::ScriptedChannel(std::istream& script) {
+    std::string line;
+    while (std::getline(script, line)) {
+        if (!line.empty() && '\r' == line[line.length() - 1]) {
+            line.erase(line.length() - 1);
+        }
+        pushLine(line);
+    }
+    close();
+}
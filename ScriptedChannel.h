@@ -0,0 +1,49 @@
+// Author: Forrest Miller
+// Filename: ScriptedChannel.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef ScriptedChannel_h
+#define ScriptedChannel_h
+
+#include "GameChannel.h"
+#include <istream>
+#include <string>
+#include <vector>
+
+//
+// Class Overview:
+//     This class feeds a game a fixed script of input lines and keeps
+//     everything the game writes, so a whole game can be played without a
+//     person (to check the rules, or to replay a session). The script is
+//     loaded up front and the channel is closed behind it, so a game played
+//     on it runs to completion inside the call that starts it.
+//
+// Valid States include: Always closed; holds whatever script is left.
+//
+// Anticipated Use:  Constructed from a file or a list of lines, handed to
+//                   GameSession::play(), and then getOutput() is the
+//                   transcript.
+//
+// Class Invariants:  None beyond GameChannel's
+//
+// Assumptions:  None
+//
+// Dependencies: GameChannel
+//
+
+class ScriptedChannel : public GameChannel {
+public:
+    ScriptedChannel(const std::vector<std::string>& script);
+    //Description: Constructs a channel that will hand out the given lines
+    //Preconditions: Lines do not contain newlines
+    //Postconditions: Channel holds the script and is closed
+
+    ScriptedChannel(std::istream& script);
+    //Description: Constructs a channel that will hand out every line of the
+    //             stream
+    //Preconditions: None
+    //Postconditions: Stream has been read to the end, channel is closed
+};
+
+#endif /* ScriptedChannel_h */
@@ -5,6 +5,7 @@
 //
 
 #include "SeqExtract.h"
+#include "Instrumentation.h"
 
 
 //
@@ -79,6 +80,7 @@ SeqExtract::SeqExtract(const std::string & s, const std::string & substr)
 }
 
 std::string SeqExtract::emitWord(void) const {
+    ProbeTimer timer(PROBE_EMIT_WORD);
     if (this->getSeqExtractIsActive() || this->getSeqEnumIsActive()) {
         return this->word;
     }
@@ -160,6 +162,13 @@ bool SeqExtract::toggleSeqExtractActivation(void) {
     return this->seqExtractIsActive;
 }
 
+bool SeqExtract::couldBeEncryptionOf(const std::string& candidate) const {
+    if (this->getSeqExtractIsActive()) {
+        return isBlockRemovalOf(this->word, candidate);
+    }
+    return SequenceEnum::couldBeEncryptionOf(candidate);
+}
+
 bool SeqExtract::checkForValidSubseq(const std::string & substrLowCase) const {
     std::size_t foundMatch = this->originalWord.find(substrLowCase);
     if (foundMatch == std::string::npos) {
@@ -169,8 +178,14 @@ bool SeqExtract::checkForValidSubseq(const std::string & substrLowCase) const {
 }
 
 void SeqExtract::performSeqExtract(const std::string & substr) {
+    ProbeTimer timer(PROBE_SEQ_EXTRACT);
+    this->ambiguityCount = 0u; //Word is about to change
     //find first occurance of substring.
     std::size_t firstMatch = this->originalWord.find(substr);
+    if (nullptr != threadTally) {
+        threadTally->countExtraction(this->wordLength, firstMatch,
+                                     substr.length());
+    }
     //Check to see if this is at the beginning of the string
     if (firstMatch == 0) {
         this->word = this->originalWord.substr(substr.length());
@@ -30,9 +30,11 @@
 //                      this, then the object will not be in a valid state, and
 //                      in fact does not contain any functionality to return it
 //                      to a valid state.
-//                       This object should be threadSafe, and will not change
-//                      it's data contents if an exception is thrown (or so I
-//                      hope).
+//                       This object is not threadSafe: toggling it changes
+//                      its word and flags. Puzzles shared between threads
+//                      should be snapshotted into an immutable Puzzle. It will
+//                      not change it's data contents if an exception is thrown
+//                      (or so I hope).
 //                      The object will be constructed into the 'On' state,
 //                     which is conviently tracked by a member boolean variable.
 //                     While 'on', calling the method emitWord() will cause the
@@ -104,6 +106,8 @@ private:
     std::string substring;
 protected:
     bool seqExtractIsActive;
+
+    friend class MemoryFootprint; //Reports the memory it takes
 public:
     //SeqExtract(const std::string & s); //This constructor doesn't make sense
     SeqExtract(const std::string & s, const std::string & substr);
@@ -149,6 +153,13 @@ public:
     // Description: returns the state of the object.
     // Preconditions: None
     // Postconditions: None, this method is const
+    
+    bool couldBeEncryptionOf(const std::string&) const override;
+    // Description: While SeqExtract is active, returns true if cutting one
+    //              run of letters out of the candidate would give the emitted
+    //              word. Otherwise behaves like the parent's method.
+    // Preconditions: The candidate should be lowercase letters only
+    // Postconditions: None, this method is const
 
     
 };
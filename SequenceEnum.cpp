@@ -4,6 +4,7 @@
 // Version:  11/18/2017 Version 1.0
 //
 #include "SequenceEnum.h"
+#include "Instrumentation.h"
 
 //
 //      Class Overview:
@@ -65,6 +66,10 @@ const uint8_t CAP_Z = 90u; //Character value of uppercase Z
 //const uint8_t CAP_A = 65u; //Character value of uppercase A
 const uint8_t LC_Z = 122u; //Character value of lowercase z
 const uint8_t LC_A = 97u; //Character value of lowercase a
+const int FAST_RANDOM_INT_SHIFT = 33; //Keep 31 bits so the int is positive
+
+thread_local FastRandom * SequenceEnum::threadRandomSource = nullptr;
+thread_local TransformTally * SequenceEnum::threadTally = nullptr;
 
 //--------------------------------------------------------------------
 //  Constructor
@@ -76,18 +81,38 @@ SequenceEnum::SequenceEnum(const std::string& inputWord) {
     convertToLower(this->originalWord); //Convert the word to lowerCase
     this->word = this->originalWord; //Set
     this->seqEnumIsActive = true;
+    this->ambiguityCount = 0u; //Not computed yet
     computeSeqEnum();
 }
 
+SequenceEnum::~SequenceEnum(void) {
+}
+
 //--------------------------------------------------------------------
 //  Functions
 //--------------------------------------------------------------------
+void SequenceEnum::setThreadRandomSource(FastRandom * source) {
+    threadRandomSource = source;
+}
+
+void SequenceEnum::setThreadTally(TransformTally * tally) {
+    threadTally = tally;
+}
+
+int SequenceEnum::randomInt(void) {
+    if (nullptr == threadRandomSource) {
+        return rand();
+    }
+    return (int) (threadRandomSource->next() >> FAST_RANDOM_INT_SHIFT);
+}
+
 std::ostream &operator<<(std::ostream& ostrm, const SequenceEnum& se) {
     ostrm << se.emitWord();
     return ostrm;
 }
 
 std::string SequenceEnum::emitWord(void) const {
+    ProbeTimer timer(PROBE_EMIT_WORD);
     if (this->seqEnumIsActive) {
         return this->word;
     } //if it's deactivated, just return the original word
@@ -98,6 +123,10 @@ bool SequenceEnum::getSeqEnumIsActive(void) const {
     return this->seqEnumIsActive;
 }
 
+unsigned long SequenceEnum::getWordLength(void) const {
+    return this->wordLength;
+}
+
 bool SequenceEnum::toggleSeqEnumActivation(void) {
     this->seqEnumIsActive = !this->seqEnumIsActive;
     return this->seqEnumIsActive;
@@ -116,10 +145,44 @@ bool SequenceEnum::guessWord(const std::string& guess) const {
 
 std::string SequenceEnum::setNewSeqEnum(void) {
     this->word = this->originalWord; //Reset word to its original form
+    this->ambiguityCount = 0u; //Old count no longer applies to the new word
     computeSeqEnum(); //Compute a new SequenceEnum for the word
     return this->word; //Return the new value
 }
 
+//The SequenceEnum only ever inserts copies of characters and never moves the
+//first letter, so the candidate must be a subsequence of the longer puzzle
+//word that begins with the same letter
+bool SequenceEnum::couldBeEncryptionOf(const std::string& candidate) const {
+    if (!this->seqEnumIsActive) {
+        return (candidate == this->originalWord);
+    }
+    if (candidate.length() >= this->word.length() || candidate.empty()) {
+        return false;
+    }
+    if (candidate.at(0) != this->word.at(0)) {
+        return false;
+    }
+    unsigned long candidateIndex = 0ul;
+    for (unsigned long i = 0ul; i < this->word.length(); i++) {
+        if (this->word[i] == candidate[candidateIndex]) {
+            candidateIndex++;
+            if (candidateIndex == candidate.length()) {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+unsigned int SequenceEnum::getAmbiguityCount(void) const {
+    return this->ambiguityCount;
+}
+
+void SequenceEnum::setAmbiguityCount(unsigned int count) {
+    this->ambiguityCount = count;
+}
+
 bool SequenceEnum::operator==(const SequenceEnum& se) const {
     if ((this->originalWord == se.originalWord) && (this->word == se.word)) {
         return true;
@@ -145,31 +208,59 @@ void SequenceEnum::convertToLower(std::string& strOfLetters) const {
     //std::cout << "\nConverted String: " << strOfLetters; //For Debug
 }
 
+//Returns true if 'shorter' is what is left of 'longer' after one contiguous
+//run of characters is cut out of it. This is the case exactly when the
+//matching prefix and matching suffix of the two words cover all of 'shorter'.
+bool SequenceEnum::isBlockRemovalOf(const std::string& shorter,
+                                    const std::string& longer) {
+    if (shorter.empty() || shorter.length() >= longer.length()) {
+        return false;
+    }
+    unsigned long prefix = 0ul;
+    while (prefix < shorter.length() && shorter[prefix] == longer[prefix]) {
+        prefix++;
+    }
+    unsigned long suffix = 0ul;
+    while (suffix < shorter.length() &&
+           shorter[shorter.length() - 1ul - suffix] ==
+           longer[longer.length() - 1ul - suffix]) {
+        suffix++;
+    }
+    return (prefix + suffix >= shorter.length());
+}
+
 //--------------------------------------------------------------------
 // Private Functions
 //--------------------------------------------------------------------
 
 void SequenceEnum::computeSeqEnum(void) {
+    ProbeTimer timer(PROBE_SEQ_ENUM);
     int charsToRepeat = 0;
+    int band = TALLY_BAND_WHOLE_WORD; //For a TransformTally, if there is one
     //First we should have it so that word and originalWord are lowercase.
     //originlWord should already be all lowercase, so no need to convert again
     
     //Next we need to find out how many characters will be repeated.
-    float randChance = (float)(rand() % ONEHUNDRED) / (float) ONEHUNDRED;
+    float randChance = (float)(randomInt() % ONEHUNDRED) /(float) ONEHUNDRED;
     if (randChance > CHANCE_ONE_CHAR) {
         charsToRepeat = SINGLE_CHAR;
+        band = TALLY_BAND_ONE;
     }
     else if (randChance > CHANCE_TWO_CHAR) {
         charsToRepeat = TWO_CHAR;
+        band = TALLY_BAND_TWO;
     }
     else if (randChance > CHANCE_THREE_CHAR) {
         charsToRepeat = THREE_CHAR;
+        band = TALLY_BAND_THREE;
     }
     else if (randChance > CHANCE_FOUR_CHAR) {
         charsToRepeat = FOUR_CHAR;
+        band = TALLY_BAND_FOUR;
     }
     else if (randChance > CHANCE_FIVE_CHAR) {
         charsToRepeat = FIVE_CHAR;
+        band = TALLY_BAND_FIVE;
     }
     else if (randChance >= CHANCE_MORE_THAN_FIVE_CHAR) {
         //Just repeat as many characters are as in the word
@@ -179,6 +270,9 @@ void SequenceEnum::computeSeqEnum(void) {
         //std::cout << "Error! Something went wrong with function rand()!";
        //std::cout << "\nRandom chance that made this occur is: " <<randChance;
     }
+    if (nullptr != threadTally) {
+        threadTally->countOutcome(this->wordLength, band);
+    }
     addCharacters(charsToRepeat); //Call other private function to add chars
 }
 
@@ -199,16 +293,20 @@ void SequenceEnum::addCharacters(int charsToRepeat) {
     if (repeatFromEnd) {
         for (int i = 0; i < charsToRepeat; i++) {
             //Set random to be an index that exists in string
-            randomIndexToGrabCharFrom =(unsigned long) rand() % wordLength;
+            randomIndexToGrabCharFrom = (unsigned long) randomInt() %
+                                        wordLength;
+            tallyPlacement(TALLY_ADD_FROM_WHOLE_WORD, this->word.length());
             this->word += this->word.at(randomIndexToGrabCharFrom);
         }
     }
     else { //if not repeatFromEnd
         for (int i = 0; i < charsToRepeat; i++) {
-            randomIndexToGrabCharFrom =(unsigned long) rand() % wordLength;
+            randomIndexToGrabCharFrom = (unsigned long) randomInt() %
+                                        wordLength;
             //If we are looking at the first character in the word
             if (randomIndexToGrabCharFrom == 0) {
                 //Repeat that character (i.e. "cat" would become "ccat")
+                tallyPlacement(TALLY_ADD_FIRST_DOUBLED, SINGLE_CHAR);
                 word = word.substr(0, SINGLE_CHAR) + word.substr(0, SINGLE_CHAR)
                 + word.substr(SINGLE_CHAR); //If we were allowed to type actual
                 //numbers into our code, this would be a lot more readable.
@@ -216,19 +314,22 @@ void SequenceEnum::addCharacters(int charsToRepeat) {
             //else if we are looking at the last character in the word
             else if (randomIndexToGrabCharFrom == word.length() - SINGLE_CHAR) {
                 // 50/50 chance to add before or after
-                if ((rand() % SINGLE_CHAR) == 0) {
+                if ((randomInt() % SINGLE_CHAR) == 0) {
                     //Add letter at end
+                    tallyPlacement(TALLY_ADD_LAST_APPENDED, word.length());
                     word += word.at(randomIndexToGrabCharFrom);
                 }
                 else { //else
                     //Don't want random index to be first or last letter so
                     //we don't go beyond string index bounds. That's what most
                     //of this confusing logic is checking/fixing
-                    randomIndexToPlaceChar = ((rand() % (int)word.length())
+                    randomIndexToPlaceChar = ((randomInt() % (int)word.length())
                                               - TWO_CHAR);
                     if (randomIndexToPlaceChar < TWO_CHAR) {
                         randomIndexToPlaceChar = TWO_CHAR;
                     }
+                    tallyPlacement(TALLY_ADD_LAST_INSERTED,
+                                   randomIndexToPlaceChar);
                     
                     word = word.substr(0, randomIndexToPlaceChar) +
                     word.at(randomIndexToGrabCharFrom) +
@@ -239,28 +340,35 @@ void SequenceEnum::addCharacters(int charsToRepeat) {
             //handle them differently as a seperate case here with a simpler
             //algorithm for repeating characters
             else if (originalWord.length() == MIN_WORD_LENGTH) {
+                tallyPlacement(TALLY_ADD_THREE_LETTER, SINGLE_CHAR);
                 word = word.substr(0,SINGLE_CHAR) + word.at(SINGLE_CHAR) +
                 word.substr(SINGLE_CHAR);
             }
             else { //Else we must be looking at a character in the middle and
                 // word is longer than 3 letters
-                if (rand() % TWO_CHAR) {
+                if (randomInt() % TWO_CHAR) {
+                    tallyPlacement(TALLY_ADD_MIDDLE_APPENDED, word.length());
                     word += word.at(randomIndexToGrabCharFrom);
                 }
                 else {
-                    if (rand() % SINGLE_CHAR) {
+                    if (randomInt() % SINGLE_CHAR) {
+                        tallyPlacement(TALLY_ADD_MIDDLE_REPLACED,
+                                       randomIndexToGrabCharFrom + SINGLE_CHAR);
                         word = word.substr(0, randomIndexToGrabCharFrom)
                         + word.at(randomIndexToGrabCharFrom) +
                         word.substr(randomIndexToGrabCharFrom + TWO_CHAR);
                     }
                     else {
-                        randomIndexToPlaceChar = (rand() % (int)word.length());
+                        randomIndexToPlaceChar = (randomInt() %
+                                                  (int)word.length());
                         if (randomIndexToPlaceChar < (unsigned long)TWO_CHAR) {
                             randomIndexToPlaceChar = (unsigned long)TWO_CHAR;
                         }
                         if (randomIndexToPlaceChar == (int)word.length()) {
                             randomIndexToPlaceChar -= (unsigned long)TWO_CHAR;
                         }
+                        tallyPlacement(TALLY_ADD_MIDDLE_INSERTED,
+                                       randomIndexToPlaceChar);
                         word = word.substr(0, randomIndexToPlaceChar) +
                         word.at(randomIndexToGrabCharFrom) +
                         word.substr(randomIndexToPlaceChar);
@@ -270,3 +378,11 @@ void SequenceEnum::addCharacters(int charsToRepeat) {
         }
     }
 }
+
+//Counts where addCharacters() placed a character, if this thread is tallying
+void SequenceEnum::tallyPlacement(int outcome, unsigned long index) const {
+    if (nullptr != threadTally) {
+        threadTally->countOutcome(this->wordLength, outcome);
+        threadTally->countInsertPosition(this->wordLength, index);
+    }
+}
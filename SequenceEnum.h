@@ -10,6 +10,8 @@
 #include <stdio.h>
 #include <stdlib.h> //rand
 #include <iostream>
+#include "FastRandom.h"
+#include "TransformTally.h"
 
 #define NDEBUG //Uncomment this for release version
 #include <assert.h>
@@ -36,9 +38,11 @@
 //                      this, then the object will not be in a valid state, and
 //                      in fact does not contain any functionality to return it
 //                      to a valid state.
-//                       This object should be threadSafe, and will not change
-//                      it's data contents if an exception is thrown (or so I
-//                      hope).
+//                       This object is not threadSafe: toggling it changes
+//                      its word and flags. Puzzles shared between threads
+//                      should be snapshotted into an immutable Puzzle. It will
+//                      not change it's data contents if an exception is thrown
+//                      (or so I hope).
 //                      The object will be constructed into the 'On' state,
 //                     which is conviently tracked by a member boolean variable.
 //                     While 'on', calling the method emitWord() will cause the
@@ -105,16 +109,22 @@
 
 class SequenceEnum {
 private:
+    static thread_local FastRandom * threadRandomSource;
     void computeSeqEnum(void);
     void addCharacters(int);
+    void tallyPlacement(int outcome, unsigned long index) const;
 protected:
+    static thread_local TransformTally * threadTally;
+
     unsigned long wordLength;
     std::string originalWord;
     std::string word;
     bool seqEnumIsActive;
+    unsigned int ambiguityCount;
     
     void convertToLower(std::string& strOfLetters) const;
     
+    friend class MemoryFootprint; //Reports the memory it takes
 public:
     //Construtor
     SequenceEnum(const std::string&);
@@ -127,6 +137,39 @@ public:
     //Postconditions: Object will exist in a valid state with SequenceEnum
     //                turned on assuming all the preconditions have been met.
     
+    virtual ~SequenceEnum(void);
+    //Description: Virtual so that SeqExtract and SpasEnum objects can be
+    //             deleted through a SequenceEnum pointer.
+    
+    static void setThreadRandomSource(FastRandom *);
+    //Description: Sets the generator that this thread uses for every random
+    //             choice made while constructing or regenerating objects. With
+    //             no source set (the default), rand() is used. Lets background
+    //             threads build objects without sharing rand()'s state.
+    //Preconditions: The generator must outlive its use on this thread
+    //Postconditions: Only affects the calling thread
+    
+    static void setThreadTally(TransformTally *);
+    //Description: Has every object this thread constructs or regenerates
+    //             count its random choices into the tally (or stops, if it
+    //             is null, the default)
+    //Preconditions: The tally must outlive its use on this thread
+    //Postconditions: Only affects the calling thread
+    
+    static int randomInt(void);
+    //Description: Returns a non-negative random int from this thread's random
+    //             source (or rand() if none has been set).
+    //Preconditions: None
+    //Postconditions: The thread's random source advances
+    
+    static bool isBlockRemovalOf(const std::string& shorter,
+                                 const std::string& longer);
+    //Description: Returns true if 'shorter' is what is left of 'longer' after
+    //             one contiguous block of letters (possibly the first or last
+    //             letters) is cut out of it, as SeqExtract does
+    //Preconditions: None
+    //Postconditions: None
+    
     friend std::ostream &operator<<(std::ostream&, const SequenceEnum&);
     // Description: this is an ostream operator, does not impact this class in
     //              any way
@@ -145,6 +188,12 @@ public:
     // Preconditions: None
     // Postconditions: None, this method is const
     
+    unsigned long getWordLength(void) const;
+    // Description: returns the length of the original (unmodified) word,
+    //              which is the length the player asked for.
+    // Preconditions: None
+    // Postconditions: None, this method is const
+    
     virtual bool toggleSeqEnumActivation(void);
     // Description: Toggles the sequenceEnum off or on. This member function
     //              is how the state of the object transitions.
@@ -173,6 +222,29 @@ public:
     //                objects state will be the same as before.
     
     
+    virtual bool couldBeEncryptionOf(const std::string&) const;
+    //Description: Returns true if the word proffered could have been the
+    //             original word that produced what emitWord() currently
+    //             returns, given whichever operation is currently active.
+    //             Used to find puzzles that have more than one valid answer.
+    // Preconditions: The candidate should be lowercase and contain only
+    //                letters.
+    // Postconditions: None, this method is const.
+    
+    unsigned int getAmbiguityCount(void) const;
+    // Description: Returns how many dictionary words could have produced the
+    //              currently emitted word. A value of 0 means the count has
+    //              not been computed (or the word has changed since).
+    // Preconditions: None
+    // Postconditions: None, this method is const
+    
+    void setAmbiguityCount(unsigned int);
+    // Description: Stores the ambiguity count computed for the currently
+    //              emitted word (see AmbiguityJob).
+    // Preconditions: None
+    // Postconditions: getAmbiguityCount() returns the stored value until the
+    //                 encrypted word is regenerated.
+    
     bool operator==(const SequenceEnum&) const;
     //Description: Returns true if two sequenceEnums encapsualte the same word
     // Preconditions: Both should be holding valid words
@@ -0,0 +1,142 @@
+// Author: Forrest Miller
+// Filename: SessionRecording.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "SessionRecording.h"
+#include <fstream>
+#include <iostream>
+#include <stdio.h>
+#include <stdlib.h>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the
+//          SessionRecording class.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const char * const RECORDING_MAGIC = "p4-session";
+const int RECORDING_VERSION = 1;
+const uint64_t FNV_PRIME = 1099511628211ull;
+const int HASH_TEXT_BYTES = 17;
+
+//Reads "key value" from the next line, where the value is a number
+static bool readNumber(std::istream& in, const char * key, uint64_t& value,
+                       int base) {
+    std::string name;
+    std::string text;
+    if (!(in >> name >> text) || name != key) {
+        return false;
+    }
+    char * end;
+    value = strtoull(text.c_str(), &end, base);
+    return '\0' == *end;
+}
+
+//--------------------------------------------------------------------
+//  Constructors
+//--------------------------------------------------------------------
+SessionRecording::SessionRecording(void) {
+    this->corpusSeed = 0ull;
+    this->sessionSeed = 0ull;
+    this->transcriptHash = EMPTY_TRANSCRIPT_HASH;
+}
+
+SessionRecording::SessionRecording(uint64_t corpus, uint64_t session) {
+    this->corpusSeed = corpus;
+    this->sessionSeed = session;
+    this->transcriptHash = EMPTY_TRANSCRIPT_HASH;
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+void SessionRecording::addLine(const std::string& line) {
+    this->lines.push_back(line);
+}
+
+void SessionRecording::addOutput(const std::string& output) {
+    this->transcriptHash = hashOutput(this->transcriptHash, output);
+}
+
+uint64_t SessionRecording::getCorpusSeed(void) const {
+    return this->corpusSeed;
+}
+
+uint64_t SessionRecording::getSessionSeed(void) const {
+    return this->sessionSeed;
+}
+
+uint64_t SessionRecording::getTranscriptHash(void) const {
+    return this->transcriptHash;
+}
+
+const std::vector<std::string>& SessionRecording::getLines(void) const {
+    return this->lines;
+}
+
+bool SessionRecording::save(const std::string& path) const {
+    std::ofstream file(path);
+    char hash[HASH_TEXT_BYTES];
+    snprintf(hash, sizeof(hash), "%016llx",
+             (unsigned long long) this->transcriptHash);
+    file << RECORDING_MAGIC << ' ' << RECORDING_VERSION << "\n"
+    "corpus-seed " << this->corpusSeed << "\n"
+    "session-seed " << this->sessionSeed << "\n"
+    "transcript-hash " << hash << "\n"
+    "lines " << this->lines.size() << "\n";
+    for (const std::string& line : this->lines) {
+        file << line << '\n';
+    }
+    file.flush();
+    if (!file) {
+        std::cerr << "Could not write the recording " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool SessionRecording::load(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        std::cerr << "Could not read the recording " << path << std::endl;
+        return false;
+    }
+    std::string magic;
+    int version = 0;
+    uint64_t count = 0ull;
+    file >> magic >> version;
+    if (magic != RECORDING_MAGIC || RECORDING_VERSION != version ||
+        !readNumber(file, "corpus-seed", this->corpusSeed, 10) ||
+        !readNumber(file, "session-seed", this->sessionSeed, 10) ||
+        !readNumber(file, "transcript-hash", this->transcriptHash, 16) ||
+        !readNumber(file, "lines", count, 10)) {
+        std::cerr << path << " is not a session recording" << std::endl;
+        return false;
+    }
+    file.ignore(1); //The newline after the count
+    this->lines.clear();
+    std::string line;
+    while (this->lines.size() < count && std::getline(file, line)) {
+        this->lines.push_back(line);
+    }
+    if (this->lines.size() != count) {
+        std::cerr << "The recording " << path << " is cut short" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+uint64_t SessionRecording::hashOutput(uint64_t hash,
+                                      const std::string& output) {
+    for (unsigned char c : output) {
+        hash ^= (uint64_t) c;
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
@@ -0,0 +1,86 @@
+// Author: Forrest Miller
+// Filename: SessionRecording.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef SessionRecording_h
+#define SessionRecording_h
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+//
+// Class Overview:
+//     This class holds everything needed to play a game again exactly as it
+//     was played: the seed the corpus was built from, the seed the session
+//     picked its words with, and every line the player typed. It also keeps
+//     a hash of everything the game wrote, so a replay can prove that it
+//     went the same way. A recorded game never draws from the puzzle pool or
+//     sees a corpus refresh (both depend on timing), so these are the only
+//     inputs a game has.
+//     Recordings are saved as text:
+//        p4-session 1
+//        corpus-seed <seed>
+//        session-seed <seed>
+//        transcript-hash <16 hex digits>
+//        lines <count>
+//     followed by the lines, one per line.
+//
+// Valid States include: Empty, being recorded, or loaded from a file.
+//
+// Anticipated Use:  A RecordingChannel fills one in during --record and it
+//                   is saved at the end. --replay loads one and hands it to
+//                   a SessionReplayer.
+//
+// Class Invariants:  -The transcript hash covers all the output added, in
+//                     order.
+//
+// Assumptions:
+//      -Input lines do not contain newlines.
+//
+// Dependencies: None
+//
+
+const uint64_t EMPTY_TRANSCRIPT_HASH = 14695981039346656037ull; //FNV-1a basis
+
+class SessionRecording {
+private:
+    uint64_t corpusSeed;
+    uint64_t sessionSeed;
+    uint64_t transcriptHash;
+    std::vector<std::string> lines;
+public:
+    SessionRecording(void);
+    //Description: Constructs an empty recording with both seeds zero
+
+    SessionRecording(uint64_t corpusSeed, uint64_t sessionSeed);
+    //Description: Constructs a recording of a game about to be played with
+    //             these seeds
+    //Postconditions: No lines and no output yet
+
+    void addLine(const std::string& line);
+    //Description: Adds a line the player typed
+
+    void addOutput(const std::string& output);
+    //Description: Adds output the game wrote to the transcript hash
+
+    uint64_t getCorpusSeed(void) const;
+    uint64_t getSessionSeed(void) const;
+    uint64_t getTranscriptHash(void) const;
+    const std::vector<std::string>& getLines(void) const;
+
+    bool save(const std::string& path) const;
+    //Description: Writes the recording to the file
+    //Postconditions: Returns false (after printing why) if it can't
+
+    bool load(const std::string& path);
+    //Description: Replaces this recording with the one in the file
+    //Postconditions: Returns false (after printing why) if the file can't be
+    //                read or isn't a recording
+
+    static uint64_t hashOutput(uint64_t hash, const std::string& output);
+    //Description: Returns the hash continued over the output (FNV-1a)
+};
+
+#endif /* SessionRecording_h */
@@ -0,0 +1,118 @@
+// Author: Forrest Miller
+// Filename: SessionReplayer.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "SessionReplayer.h"
+#include "EventLog.h"
+#include "FastRandom.h"
+#include "GameTask.h"
+#include "ScriptedChannel.h"
+#include <algorithm>
+#include <iostream>
+#include <stdio.h>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the
+//          SessionReplayer class. A scripted game runs to completion inside
+//          play(), so timing the call times the whole game.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const double NANOS_PER_REPLAY_MICRO = 1e3;
+const double MICROS_PER_REPLAY_SECOND = 1e6;
+const int REPLAY_LINE_BYTES = 128;
+const char * const OUTCOME_NAMES[] = {"won", "lost", "abandoned"};
+
+static double toMicros(std::chrono::steady_clock::duration duration) {
+    return (double) std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                        duration).count() /
+           NANOS_PER_REPLAY_MICRO;
+}
+
+//Returns the median and the smallest of the durations
+static void summarize(std::vector<std::chrono::steady_clock::duration> times,
+                      double& median, double& fastest) {
+    std::sort(times.begin(), times.end());
+    median = toMicros(times[times.size() / 2u]);
+    fastest = toMicros(times[0]);
+}
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+SessionReplayer::SessionReplayer(EpochCorpus& epochs,
+                                 const SessionRecording& recorded)
+: corpusEpochs(epochs), recording(recorded) {
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+bool SessionReplayer::run(int repetitions) {
+    this->rounds.clear();
+    this->games.clear();
+    int readerSlot = this->corpusEpochs.registerReader();
+    this->corpusEpochs.waitForCorpus();
+    bool matched = true;
+    for (int rep = 0; rep < repetitions && matched; rep++) {
+        ScriptedChannel script(this->recording.getLines());
+        FastRandom rng(this->recording.getSessionSeed());
+        GameSession session(this->corpusEpochs, readerSlot, rng);
+        std::vector<RoundTiming> timings;
+        timings.reserve(this->recording.getLines().size());
+        session.recordRoundTimings(&timings);
+        auto started = std::chrono::steady_clock::now();
+        GameTask game = session.play(script); //Finishes before returning
+        this->games.push_back(std::chrono::steady_clock::now() - started);
+        uint64_t hash = SessionRecording::hashOutput(EMPTY_TRANSCRIPT_HASH,
+                                              script.getOutput().toString());
+        if (hash != this->recording.getTranscriptHash()) {
+            std::cerr << "Replay " << rep + 1 << " went differently from "
+            "the recording (was it recorded by a build with other words?)"
+            << std::endl;
+            matched = false;
+        }
+        this->rounds.push_back(timings);
+    }
+    this->corpusEpochs.unregisterReader(readerSlot);
+    return matched;
+}
+
+void SessionReplayer::report(std::ostream& out) const {
+    const std::vector<RoundTiming>& first = this->rounds[0];
+    out << "Replayed " << first.size() << " rounds ("
+    << this->recording.getLines().size() << " input lines) "
+    << this->rounds.size() << " times; every transcript matched the "
+    "recording\n"
+    "Round  Length  Guesses  Outcome     Median (us)  Fastest (us)\n";
+    char line[REPLAY_LINE_BYTES];
+    std::vector<std::chrono::steady_clock::duration> times;
+    for (size_t round = 0u; round < first.size(); round++) {
+        times.clear();
+        for (const std::vector<RoundTiming>& rep : this->rounds) {
+            times.push_back(rep[round].took);
+        }
+        double median;
+        double fastest;
+        summarize(times, median, fastest);
+        snprintf(line, sizeof(line), "%5zu  %6d  %7d  %-9s %13.2f %13.2f\n",
+                 round + 1u, first[round].wordLength, first[round].guesses,
+                 OUTCOME_NAMES[first[round].outcome], median, fastest);
+        out << line;
+    }
+    double median;
+    double fastest;
+    summarize(this->games, median, fastest);
+    snprintf(line, sizeof(line), "Whole game: median %.2f us, fastest %.2f us"
+             " (%.0f rounds/s)\n", median, fastest,
+             median > 0.0 ? (double) first.size() *
+             MICROS_PER_REPLAY_SECOND / median : 0.0);
+    out << line;
+    out.flush();
+}
@@ -0,0 +1,69 @@
+// Author: Forrest Miller
+// Filename: SessionReplayer.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef SessionReplayer_h
+#define SessionReplayer_h
+
+#include "EpochCorpus.h"
+#include "GameSession.h"
+#include "SessionRecording.h"
+#include <chrono>
+#include <ostream>
+#include <vector>
+
+//
+// Class Overview:
+//     This class plays a recorded game again, as fast as it will go, to use
+//     a real player's session as a repeatable benchmark. Each repetition
+//     plays the recorded lines through a ScriptedChannel with a generator
+//     seeded from the recording, against a corpus built from the recording's
+//     corpus seed, so it makes exactly the same choices the recorded game
+//     did. Its transcript is hashed and checked against the recording's, and
+//     every round is timed. The report gives each round's median and fastest
+//     time over the repetitions, and the whole game's.
+//
+// Valid States include: Not yet run, or run (holding every repetition's
+//                       timings).
+//
+// Anticipated Use:  main() builds the corpus from the recording's seed
+//                   (with no refreshes), then runs and reports a replayer
+//                   for --replay.
+//
+// Class Invariants:  -Every repetition that was kept has the same rounds.
+//
+// Assumptions:
+//      -The corpus was built from the recording's corpus seed, by a build
+//       with the same word arrays, and is not refreshed during the replay.
+//      -A corpus reader slot is free.
+//
+// Dependencies: EpochCorpus, GameSession, ScriptedChannel, SessionRecording,
+//               FastRandom
+//
+
+class SessionReplayer {
+private:
+    EpochCorpus& corpusEpochs;
+    const SessionRecording& recording;
+    std::vector<std::vector<RoundTiming> > rounds;  //One list per repetition
+    std::vector<std::chrono::steady_clock::duration> games;
+
+    SessionReplayer(const SessionReplayer&);
+    SessionReplayer& operator=(const SessionReplayer&);
+public:
+    SessionReplayer(EpochCorpus&, const SessionRecording&);
+    //Description: Constructs a replayer of the recording against the corpus
+
+    bool run(int repetitions);
+    //Description: Replays the game the given number of times
+    //Postconditions: Returns false (after printing why) as soon as a
+    //                replay's transcript differs from the recording's
+
+    void report(std::ostream& out) const;
+    //Description: Prints a line per round with its word length, guesses,
+    //             outcome and median and fastest time, then the whole game's
+    //Preconditions: run() succeeded
+};
+
+#endif /* SessionReplayer_h */
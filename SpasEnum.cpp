@@ -4,6 +4,7 @@
 // Version:  11/18/2017 Version 1.0
 //
 #include "SpasEnum.h"
+#include "Instrumentation.h"
 
 //
 //      Class Overview:
@@ -52,25 +53,37 @@ const short LENGTH_OF_SINGLE_CHARACTER = 1;
 SpasEnum::SpasEnum(const std::string & s) : SequenceEnum(s) {
     this->seqEnumIsActive = false;
     this->spasEnumIsActive = true;
-    computeSpasEnum(s);
+    computeSpasEnum();
 }
 
-void SpasEnum::computeSpasEnum(const std::string & wrd) {
+//Cuts from or appends to the lowercase originalWord, never the raw input,
+//so the puzzle never mixes cases
+void SpasEnum::computeSpasEnum(void) {
+    ProbeTimer timer(PROBE_SPAS_ENUM);
     int substringStart; //Start index for a substring
     int substringLength; //Number of characters in the substring
-    short willTruncate = ((short) rand()) % CHANCE_TO_CONCATENATE;
+    short willTruncate = ((short) randomInt()) % CHANCE_TO_CONCATENATE;
+    this->ambiguityCount = 0u; //Word is about to change
     
     //Need to figure out a random substring, so
     //Step 1) Get the starting index for a substring
-    substringStart = rand() % (int) this->wordLength;
+    substringStart = randomInt() % (int) this->wordLength;
     //Step 2) Calculate a length for the substring (not longer than end of word)
-    substringLength = rand() %( ((int)this->wordLength) - substringStart);
+    substringLength = randomInt() %( ((int)this->wordLength) - substringStart);
     //having a length of 0 though won't count, so if 0 make it 1
     if (0 == substringLength) {
         substringLength = LENGTH_OF_SINGLE_CHARACTER;
     }
+    if (nullptr != threadTally) {
+        threadTally->countOutcome(this->wordLength, (0 == willTruncate) ?
+                                  TALLY_SPAS_CONCATENATED :
+                                  TALLY_SPAS_TRUNCATED);
+        threadTally->countSpasSubstring(this->wordLength, substringStart,
+                                        substringLength);
+    }
     //Now that we have a start position and a length, form the substring
-    this->substring = wrd.substr(substringStart, substringLength);
+    this->substring = this->originalWord.substr(substringStart,
+                                               substringLength);
     //Finally, Decide to truncate or concatinate
     if (0 == willTruncate) { //Then will concatanate
         this->word = this->originalWord + this->substring;
@@ -87,6 +100,7 @@ void SpasEnum::computeSpasEnum(const std::string & wrd) {
 //}
 
 std::string SpasEnum::emitWord() const {
+    ProbeTimer timer(PROBE_EMIT_WORD);
     if (this->getSpasEnumIsActive() || this->getSeqEnumIsActive()) {
         return this->word;
     }
@@ -99,6 +113,22 @@ bool SpasEnum::getSpasEnumIsActive(void) const {
     return this->spasEnumIsActive;
 }
 
+bool SpasEnum::couldBeEncryptionOf(const std::string& candidate) const {
+    if (!this->getSpasEnumIsActive()) {
+        return SequenceEnum::couldBeEncryptionOf(candidate);
+    }
+    if (this->word.length() > candidate.length()) { //Concatenated
+        //Word must start with the candidate, and what follows must be a
+        //substring of the candidate
+        if (this->word.compare(0, candidate.length(), candidate) != 0) {
+            return false;
+        }
+        return (candidate.find(this->word.substr(candidate.length())) !=
+                std::string::npos);
+    }
+    return isBlockRemovalOf(this->word, candidate); //Truncated
+}
+
 bool SpasEnum::toggleSeqEnumActivation(void) {
     //Check to see if SeqEnum is active
     if (this->getSeqEnumIsActive()) {
@@ -119,14 +149,14 @@ bool SpasEnum::toggleSpasEnumActivation(void) {
     if (this->getSeqEnumIsActive()) {
         this->seqEnumIsActive = false;
         this->spasEnumIsActive = true;
-        computeSpasEnum(this->originalWord);
+        computeSpasEnum();
     }
     else if (this->spasEnumIsActive) {
         this->spasEnumIsActive = false;
     }
     else {
         this->spasEnumIsActive = true;
-        computeSpasEnum(this->originalWord);
+        computeSpasEnum();
     }
     return this->spasEnumIsActive;
 }
@@ -30,9 +30,11 @@
 //                      this, then the object will not be in a valid state, and
 //                      in fact does not contain any functionality to return it
 //                      to a valid state.
-//                       This object should be threadSafe, and will not change
-//                      it's data contents if an exception is thrown (or so I
-//                      hope).
+//                       This object is not threadSafe: toggling it changes
+//                      its word and flags. Puzzles shared between threads
+//                      should be snapshotted into an immutable Puzzle. It will
+//                      not change it's data contents if an exception is thrown
+//                      (or so I hope).
 //                      The object will be constructed into the 'On' state,
 //                     which is conviently tracked by a member boolean variable.
 //                     While 'on', calling the method emitWord() will cause the
@@ -100,9 +102,11 @@
 class SpasEnum : public SequenceEnum {
 private:
     std::string substring;
-    void computeSpasEnum(const std::string& );
+    void computeSpasEnum(void);
 protected:
     bool spasEnumIsActive;
+
+    friend class MemoryFootprint; //Reports the memory it takes
 public:
     SpasEnum(const std::string &);
     //Description: Constructs the object with the string reference proffered as
@@ -138,9 +142,17 @@ public:
     //                  it was in before this method was called.
     //
     bool getSpasEnumIsActive(void) const;
-    / Description: returns the state of the object.
+    // Description: returns the state of the object.
     // Preconditions: None
     // Postconditions: None, this method is const
+    
+    bool couldBeEncryptionOf(const std::string&) const override;
+    // Description: While SpasEnum is active, returns true if the emitted word
+    //              is the candidate with one of its own substrings appended,
+    //              or is the candidate with one run of letters cut out.
+    //              Otherwise behaves like the parent's method.
+    // Preconditions: The candidate should be lowercase letters only
+    // Postconditions: None, this method is const
 
 };
 
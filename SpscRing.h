@@ -0,0 +1,119 @@
+// Author: Forrest Miller
+// Filename: SpscRing.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef SpscRing_h
+#define SpscRing_h
+
+#include <atomic>
+#include <stddef.h>
+#include <vector>
+
+//
+// Class Overview:
+//     This class template is a bounded, lock-free ring buffer for exactly one
+//     producer thread and one consumer thread. Pushing and popping are each a
+//     couple of atomic loads and one atomic store, and never block: tryPush()
+//     fails when the ring is full and tryPop() fails when it is empty.
+//
+// Valid States include: Always valid once constructed. The capacity is fixed
+//                       at construction and rounded up to a power of two.
+//
+// Anticipated Use:  Handing work between a background thread and the game
+//                   loop (or between pipeline stages) without locks.
+//
+// Class Invariants:  -Only one thread ever calls tryPush() and only one thread
+//                     ever calls tryPop() (they may be different threads).
+//                    -0 <= tail - head <= capacity at all times.
+//
+// Assumptions:
+//      -T is cheap to copy or move (pointers, small structs).
+//
+// Dependencies: None
+//
+
+const size_t CACHE_LINE_BYTES = 64;
+
+template <typename T>
+class SpscRing {
+private:
+    //The consumer's and producer's fields are aligned onto separate cache
+    //lines so the two threads don't keep stealing the same line from each
+    //other.
+    std::vector<T> slots;
+    size_t mask;
+    alignas(CACHE_LINE_BYTES) std::atomic<size_t> head; //Next slot to pop
+    size_t cachedTail;        //Consumer's copy of tail
+    alignas(CACHE_LINE_BYTES) std::atomic<size_t> tail; //Next slot to push
+    size_t cachedHead;        //Producer's copy of head
+public:
+    SpscRing(size_t minimumCapacity) {
+        size_t capacity = 1;
+        while (capacity < minimumCapacity) {
+            capacity <<= 1;
+        }
+        this->slots.resize(capacity);
+        this->mask = capacity - 1;
+        this->head.store(0);
+        this->tail.store(0);
+        this->cachedHead = 0;
+        this->cachedTail = 0;
+    }
+    //Description: Constructs an empty ring holding at least minimumCapacity
+    //             elements
+    //Preconditions: minimumCapacity should be greater than 0
+    //Postconditions: Ring is empty
+
+    bool tryPush(const T& value) {
+        const size_t t = this->tail.load(std::memory_order_relaxed);
+        if (t - this->cachedHead > this->mask) {
+            this->cachedHead = this->head.load(std::memory_order_acquire);
+            if (t - this->cachedHead > this->mask) {
+                return false; //Full
+            }
+        }
+        this->slots[t & this->mask] = value;
+        this->tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+    //Description: Adds the value at the back of the ring
+    //Preconditions: Only called from the producer thread
+    //Postconditions: Returns false (and does nothing) if the ring is full
+
+    bool tryPop(T& value) {
+        const size_t h = this->head.load(std::memory_order_relaxed);
+        if (h == this->cachedTail) {
+            this->cachedTail = this->tail.load(std::memory_order_acquire);
+            if (h == this->cachedTail) {
+                return false; //Empty
+            }
+        }
+        value = this->slots[h & this->mask];
+        this->head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+    //Description: Removes the value at the front of the ring
+    //Preconditions: Only called from the consumer thread
+    //Postconditions: Returns false (and leaves value alone) if the ring is
+    //                empty
+
+    size_t size(void) const {
+        //Read head first: tail never falls behind a head read earlier
+        const size_t h = this->head.load(std::memory_order_acquire);
+        return this->tail.load(std::memory_order_acquire) - h;
+    }
+    //Description: Returns roughly how many elements are in the ring. Exact
+    //             only when neither side is running.
+    //Preconditions: None
+    //Postconditions: None, this method is const
+
+    size_t capacity(void) const {
+        return this->mask + 1;
+    }
+    //Description: Returns the number of elements the ring can hold
+    //Preconditions: None
+    //Postconditions: None, this method is const
+};
+
+#endif /* SpscRing_h */
@@ -0,0 +1,85 @@
+// Author: Forrest Miller
+// Filename: StartupTimer.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "StartupTimer.h"
+#include <mutex>
+#include <stdio.h>
+#include <thread>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the StartupTimer
+//          class. Startup records only a handful of phases, so they are kept
+//          in a fixed array under a mutex.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const double NANOS_PER_STARTUP_MILLI = 1e6;
+const int STARTUP_LINE_BYTES = 128;
+
+struct RecordedPhase {
+    const char * name;
+    bool background;
+    std::chrono::steady_clock::duration startedAt; //Since the origin
+    std::chrono::steady_clock::duration took;
+};
+
+static std::mutex phasesLock;
+static RecordedPhase phases[MAX_STARTUP_PHASES];
+static int numPhases = 0;
+
+//The thread that ran static initialization, which is main()'s
+static std::thread::id mainThread(void) {
+    static const std::thread::id id = std::this_thread::get_id();
+    return id;
+}
+
+static double toMillis(std::chrono::steady_clock::duration duration) {
+    return (double) std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                        duration).count() /
+           NANOS_PER_STARTUP_MILLI;
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+std::chrono::steady_clock::time_point StartupTimer::origin(void) {
+    static const std::chrono::steady_clock::time_point first =
+    std::chrono::steady_clock::now();
+    mainThread();
+    return first;
+}
+
+void StartupTimer::record(const char * phase,
+                          std::chrono::steady_clock::time_point started,
+                          std::chrono::steady_clock::time_point ended) {
+    std::chrono::steady_clock::time_point from = origin();
+    std::lock_guard<std::mutex> lock(phasesLock);
+    if (numPhases >= MAX_STARTUP_PHASES) {
+        return;
+    }
+    RecordedPhase& recorded = phases[numPhases++];
+    recorded.name = phase;
+    recorded.background = (std::this_thread::get_id() != mainThread());
+    recorded.startedAt = started - from;
+    recorded.took = ended - started;
+}
+
+void StartupTimer::report(std::ostream& out) {
+    std::lock_guard<std::mutex> lock(phasesLock);
+    out << "Startup phase              Thread      Start (ms)   Took (ms)\n";
+    char line[STARTUP_LINE_BYTES];
+    for (int i = 0; i < numPhases; i++) {
+        snprintf(line, sizeof(line), "%-26s %-10s %11.3f %11.3f\n",
+                 phases[i].name, phases[i].background ? "background" : "main",
+                 toMillis(phases[i].startedAt), toMillis(phases[i].took));
+        out << line;
+    }
+    out.flush();
+}
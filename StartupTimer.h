@@ -0,0 +1,83 @@
+// Author: Forrest Miller
+// Filename: StartupTimer.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef StartupTimer_h
+#define StartupTimer_h
+
+#include <chrono>
+#include <ostream>
+
+//
+// Class Overview:
+//     These classes time each phase of the program's startup, so we can see
+//     what stands between launching the process and the first prompt. Every
+//     phase is kept with when it started (counted from the origin, the
+//     first thing the program's own static initialization does) and how long
+//     it took, along with whether it ran on the main thread or in the
+//     background. A StartupPhase times the scope it is declared in, and
+//     phases that aren't a scope (like the static word arrays) are recorded
+//     directly.
+//
+// Valid States include: StartupTimer has only static members. A
+//                       StartupPhase is timing until end() or its
+//                       destruction.
+//
+// Anticipated Use:  main() records its phases and prints them with
+//                   --startup-bench.
+//
+// Class Invariants:  -Phases are kept in the order they were recorded.
+//
+// Assumptions:
+//      -origin() is first called during static initialization, on the
+//       thread that goes on to run main().
+//      -At most MAX_STARTUP_PHASES phases are recorded.
+//
+// Dependencies: None
+//
+
+const int MAX_STARTUP_PHASES = 32;
+
+class StartupTimer {
+public:
+    static std::chrono::steady_clock::time_point origin(void);
+    //Description: Returns the time of the first call, which every phase is
+    //             counted from
+
+    static void record(const char * phase,
+                       std::chrono::steady_clock::time_point started,
+                       std::chrono::steady_clock::time_point ended);
+    //Description: Records one phase. Safe from any thread.
+    //Preconditions: phase is a string literal
+
+    static void report(std::ostream& out);
+    //Description: Prints every phase with its thread, its start and how long
+    //             it took, in milliseconds
+};
+
+//Times the scope it is declared in as one startup phase
+class StartupPhase {
+private:
+    const char * name;
+    std::chrono::steady_clock::time_point started;
+    bool ended;
+
+    StartupPhase(const StartupPhase&);
+    StartupPhase& operator=(const StartupPhase&);
+public:
+    explicit StartupPhase(const char * phase)
+    : name(phase), started(std::chrono::steady_clock::now()), ended(false) {}
+    ~StartupPhase(void) { end(); }
+
+    void end(void) {
+        if (!this->ended) {
+            StartupTimer::record(this->name, this->started,
+                                 std::chrono::steady_clock::now());
+            this->ended = true;
+        }
+    }
+    //Description: Ends the phase before the end of its scope
+};
+
+#endif /* StartupTimer_h */
@@ -0,0 +1,45 @@
+// Author: Forrest Miller
+// Filename: TerminalChannel.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "TerminalChannel.h"
+#include <errno.h>
+#include <iostream>
+#include <unistd.h>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the TerminalChannel
+//          class.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+//Everything the game wrote since the last read goes out in one writev()
+void TerminalChannel::flush(void) {
+    OutputBuffer& output = getOutput();
+    std::cout.flush(); //Keep anything main() printed in front of the game
+    while (!output.empty()) {
+        if (output.writeTo(STDOUT_FILENO) < 0 && EINTR != errno) {
+            output.clear(); //Nowhere to write it
+        }
+    }
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+bool TerminalChannel::readMore(void) {
+    std::string line;
+    if (std::getline(std::cin, line)) {
+        pushLine(line);
+    }
+    else {
+        close();
+    }
+    return true;
+}
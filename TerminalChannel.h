@@ -0,0 +1,42 @@
+// Author: Forrest Miller
+// Filename: TerminalChannel.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef TerminalChannel_h
+#define TerminalChannel_h
+
+#include "GameChannel.h"
+
+//
+// Class Overview:
+//     This class connects a game to the terminal. Output is written to
+//     standard output, in a single writev(), whenever the game is about to
+//     wait for input, and input is read from
+//     std::cin a line at a time, blocking. Since input is always pulled
+//     synchronously, a game played on this channel never actually suspends;
+//     it runs start to finish inside the call that starts it.
+//
+// Valid States include: Open, or closed once std::cin hits end of file.
+//
+// Anticipated Use:  One per process in the interactive game.
+//
+// Class Invariants:  None beyond GameChannel's
+//
+// Assumptions:
+//      -Nothing else reads std::cin while a game is running.
+//
+// Dependencies: GameChannel
+//
+
+class TerminalChannel : public GameChannel {
+protected:
+    bool readMore(void) override;
+    //Description: Blocks for the next line of std::cin, closing the channel
+    //             at end of file
+public:
+    void flush(void) override;
+    //Description: Writes the pending output to standard output
+};
+
+#endif /* TerminalChannel_h */
@@ -0,0 +1,219 @@
+// Author: Forrest Miller
+// Filename: Tracer.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "Tracer.h"
+#include "SpscRing.h"
+#include "FastRandom.h"
+#include <atomic>
+#include <condition_variable>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <stdio.h>
+#include <thread>
+#include <vector>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the Tracer and
+//          TraceSpan classes. A thread's ring is created the first time it
+//          records and kept for the life of the process, so the flusher can
+//          still empty it after the thread is gone. Sessions are written as
+//          threads of one process in the trace, named "session N", which is
+//          what gives each its own timeline in the viewer. The name is
+//          written by the flusher just before a session's first span, so a
+//          session that never records one (say, one left idle at its first
+//          prompt) leaves nothing in the trace.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const size_t TRACE_RING_EVENTS = 16384;
+const std::chrono::milliseconds TRACE_FLUSH_INTERVAL(100);
+const double NANOS_PER_TRACE_MICRO = 1000.0;
+const int TRACE_LINE_BYTES = 192;
+const int TRACE_PROCESS_ID = 1;
+
+//One span
+struct TraceEvent {
+    const char * name;
+    uint32_t session;
+    uint32_t round;
+    uint64_t startNs; //Since the trace started
+    uint64_t durationNs;
+};
+
+struct ThreadTrace {
+    SpscRing<TraceEvent> ring;
+    std::atomic<uint64_t> dropped; //Written only by the ring's thread
+    ThreadTrace(void) : ring(TRACE_RING_EVENTS), dropped(0u) {}
+};
+
+static std::mutex registryLock; //Only taken by a thread's first record
+static std::vector<ThreadTrace *> registry;
+thread_local ThreadTrace * threadTrace = nullptr;
+
+static std::atomic<bool> tracing(false);
+static std::atomic<uint32_t> nextSession(1u);
+static double sessionSampleRate = 1.0;
+static std::chrono::steady_clock::time_point traceStarted;
+static std::ofstream traceFile;
+static bool wroteEvent = false;
+static std::vector<bool> namedSessions; //Only touched while writing events
+static std::thread flusher;
+static std::mutex flusherLock; //Only used to put the flusher to sleep
+static std::condition_variable flusherWake;
+static bool stopRequested = false;
+
+//Each thread samples with a generator of its own, seeded apart from the others
+static FastRandom& sampleRandom(void) {
+    thread_local FastRandom random((uint64_t)
+    std::chrono::steady_clock::now().time_since_epoch().count() ^
+    (uint64_t) std::hash<std::thread::id>()(std::this_thread::get_id()));
+    return random;
+}
+
+static void push(const TraceEvent& event) {
+    ThreadTrace * mine = threadTrace;
+    if (nullptr == mine) {
+        mine = new ThreadTrace();
+        std::lock_guard<std::mutex> lock(registryLock);
+        registry.push_back(mine);
+        threadTrace = mine;
+    }
+    if (!mine->ring.tryPush(event)) {
+        mine->dropped.store(mine->dropped.load(std::memory_order_relaxed) + 1u,
+                            std::memory_order_relaxed);
+    }
+}
+
+static void writeLine(const char * line) {
+    traceFile << (wroteEvent ? ",\n" : "\n") << line;
+    wroteEvent = true;
+}
+
+static void writeEvent(const TraceEvent& event) {
+    char line[TRACE_LINE_BYTES];
+    if (event.session >= namedSessions.size()) {
+        namedSessions.resize((size_t) event.session + 1u, false);
+    }
+    if (!namedSessions[event.session]) { //The session's first span
+        namedSessions[event.session] = true;
+        snprintf(line, sizeof(line), "{\"name\": \"thread_name\", \"ph\": "
+                 "\"M\", \"pid\": %d, \"tid\": %u, \"args\": {\"name\": "
+                 "\"session %u\"}}", TRACE_PROCESS_ID, event.session,
+                 event.session);
+        writeLine(line);
+    }
+    snprintf(line, sizeof(line), "{\"name\": \"%s\", \"cat\": \"game\", "
+             "\"ph\": \"X\", \"ts\": %.3f, \"dur\": %.3f, \"pid\": %d, "
+             "\"tid\": %u, \"args\": {\"round\": %u}}", event.name,
+             (double) event.startNs / NANOS_PER_TRACE_MICRO,
+             (double) event.durationNs / NANOS_PER_TRACE_MICRO,
+             TRACE_PROCESS_ID, event.session, event.round);
+    writeLine(line);
+}
+
+//Empties every thread's ring into the file
+static void drainRings(void) {
+    std::vector<ThreadTrace *> threads;
+    {
+        std::lock_guard<std::mutex> lock(registryLock);
+        threads = registry;
+    }
+    TraceEvent event;
+    for (ThreadTrace * thread : threads) {
+        while (thread->ring.tryPop(event)) {
+            writeEvent(event);
+        }
+    }
+    traceFile.flush();
+}
+
+static void flushLoop(void) {
+    std::unique_lock<std::mutex> lock(flusherLock);
+    while (!stopRequested) {
+        flusherWake.wait_for(lock, TRACE_FLUSH_INTERVAL);
+        lock.unlock();
+        drainRings();
+        lock.lock();
+    }
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+bool Tracer::start(const std::string& path, double sampleRate) {
+    traceFile.open(path, std::ios::out | std::ios::trunc);
+    if (!traceFile) {
+        std::cerr << "Could not write the trace to " << path << std::endl;
+        return false;
+    }
+    traceFile << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [";
+    sessionSampleRate = sampleRate;
+    traceStarted = std::chrono::steady_clock::now();
+    stopRequested = false;
+    tracing.store(true);
+    flusher = std::thread(flushLoop);
+    return true;
+}
+
+void Tracer::stop(void) {
+    if (!tracing.exchange(false)) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(flusherLock);
+        stopRequested = true;
+    }
+    flusherWake.notify_one();
+    flusher.join();
+    drainRings(); //Whatever came in after the flusher's last pass
+    uint64_t dropped = 0u;
+    {
+        std::lock_guard<std::mutex> lock(registryLock);
+        for (ThreadTrace * thread : registry) {
+            dropped += thread->dropped.load(std::memory_order_relaxed);
+        }
+    }
+    traceFile << "\n]}\n";
+    traceFile.close();
+    if (dropped > 0u) {
+        std::cerr << "Trace dropped " << dropped << " spans (buffers full)"
+        << std::endl;
+    }
+}
+
+uint32_t Tracer::sampleSession(void) {
+    if (!tracing.load(std::memory_order_acquire)) {
+        return NOT_TRACED;
+    }
+    if (sessionSampleRate < 1.0 &&
+        sampleRandom().nextUnit() >= sessionSampleRate) {
+        return NOT_TRACED;
+    }
+    return nextSession.fetch_add(1u, std::memory_order_relaxed);
+}
+
+void Tracer::record(const char * name, uint32_t session, uint32_t round,
+                    std::chrono::steady_clock::time_point started,
+                    std::chrono::steady_clock::time_point ended) {
+    if (!tracing.load(std::memory_order_acquire)) {
+        return;
+    }
+    TraceEvent event;
+    event.name = name;
+    event.session = session;
+    event.round = round;
+    event.startNs = (uint64_t) std::chrono::duration_cast<
+    std::chrono::nanoseconds>(started - traceStarted).count();
+    event.durationNs = (uint64_t) std::chrono::duration_cast<
+    std::chrono::nanoseconds>(ended - started).count();
+    push(event);
+}
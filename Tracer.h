@@ -0,0 +1,120 @@
+// Author: Forrest Miller
+// Filename: Tracer.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef Tracer_h
+#define Tracer_h
+
+#include <chrono>
+#include <stdint.h>
+#include <string>
+
+//
+// Class Overview:
+//     These classes record what happens inside a game's rounds as timed
+//     spans (picking the word, getting the puzzle, drawing the prompt,
+//     waiting for the player and grading the guess) and write them out in
+//     the Chrome trace event format, which a browser trace viewer (such as
+//     Perfetto or chrome://tracing) draws as timelines. Each traced session
+//     gets a timeline of its own, so a slow round can be looked at on its
+//     own even when one thread runs thousands of games.
+//
+//     Recording a span never takes a lock or makes a system call: the span is
+//     pushed into a ring owned by the recording thread, and a background
+//     thread empties every ring into the file. If a ring is full the span is
+//     dropped and counted rather than making the game wait. Only a sampled
+//     fraction of sessions is traced, chosen when the session starts, so
+//     tracing can stay on in production; a session that isn't traced costs
+//     one test per span.
+//
+// Valid States include: Stopped (the default), or tracing to a file between
+//                       start() and stop().
+//
+// Anticipated Use:  main() calls start() once with --trace and stop() at
+//                   shutdown. Each GameSession calls sampleSession() when it
+//                   starts and declares TraceSpans around the steps of its
+//                   rounds.
+//
+// Class Invariants:  -A thread's ring is pushed to only by that thread and
+//                     popped only by the flusher (or by stop() once the
+//                     flusher has finished).
+//                    -Every span written lies on its session's timeline.
+//
+// Assumptions:
+//      -Span names are string literals (only the pointer is kept).
+//      -start() and stop() are called from the same thread, once each.
+//
+// Dependencies: SpscRing, FastRandom
+//
+
+const uint32_t NOT_TRACED = 0u; //Session id of a session that isn't sampled
+
+const char TRACE_ROUND[] = "round";
+const char TRACE_SELECT[] = "select";
+const char TRACE_GENERATE[] = "generate";
+const char TRACE_RENDER[] = "render";
+const char TRACE_INPUT_WAIT[] = "input wait";
+const char TRACE_GRADE[] = "grade";
+
+class Tracer {
+public:
+    static bool start(const std::string& path, double sampleRate);
+    //Description: Starts writing sampled sessions' spans to the file
+    //Preconditions: sampleRate is between 0 and 1; not already started
+    //Postconditions: Returns false (after printing why) if the file can't
+    //                be written
+
+    static void stop(void);
+    //Description: Writes out every span still buffered, finishes the file
+    //             and prints how many spans were dropped, if any
+    //Preconditions: None (does nothing if not started)
+    //Postconditions: Spans recorded from now on are ignored
+
+    static uint32_t sampleSession(void);
+    //Description: Decides whether a new session is traced
+    //Preconditions: None
+    //Postconditions: Returns the session's timeline id, or NOT_TRACED
+
+    static void record(const char * name, uint32_t session, uint32_t round,
+                       std::chrono::steady_clock::time_point started,
+                       std::chrono::steady_clock::time_point ended);
+    //Description: Queues one finished span for the flusher
+    //Preconditions: session is not NOT_TRACED
+    //Postconditions: The span is dropped if tracing has stopped or this
+    //                thread's ring is full
+};
+
+class TraceSpan {
+private:
+    const char * name;
+    uint32_t session;
+    uint32_t round;
+    std::chrono::steady_clock::time_point started;
+
+    TraceSpan(const TraceSpan&);
+    TraceSpan& operator=(const TraceSpan&);
+public:
+    TraceSpan(uint32_t traceSession, uint32_t traceRound, const char * span)
+    : name(span), session(traceSession), round(traceRound) {
+        if (NOT_TRACED != this->session) {
+            this->started = std::chrono::steady_clock::now();
+        }
+    }
+    //Description: Starts timing a span of the session's round. Does nothing
+    //             for a session that isn't traced.
+
+    ~TraceSpan(void) { end(); }
+    //Description: Ends the span if end() hasn't already
+
+    void end(void) {
+        if (NOT_TRACED != this->session) {
+            Tracer::record(this->name, this->session, this->round,
+                           this->started, std::chrono::steady_clock::now());
+            this->session = NOT_TRACED;
+        }
+    }
+    //Description: Ends the span before the end of its scope
+};
+
+#endif /* Tracer_h */
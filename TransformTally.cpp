@@ -0,0 +1,43 @@
+// Author: Forrest Miller
+// Filename: TransformTally.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "TransformTally.h"
+#include <string.h>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the TransformTally
+//          class. The counting itself is inline in the header, since the
+//          transforms count every choice they make.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+TransformTally::TransformTally(void) {
+    memset(this->lengths, 0, sizeof(this->lengths));
+    this->variant = 0;
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+//Every field of a LengthTally is a uint64_t count, so they add as one array
+void TransformTally::add(const TransformTally& other) {
+    const size_t countsPerLength = sizeof(LengthTally) / sizeof(uint64_t);
+    for (int len = 0; len < MAX_TALLY_WORD_LENGTH; len++) {
+        uint64_t * mine = (uint64_t *) &this->lengths[len];
+        const uint64_t * theirs = (const uint64_t *) &other.lengths[len];
+        for (size_t i = 0u; i < countsPerLength; i++) {
+            mine[i] += theirs[i];
+        }
+    }
+}
+
+const LengthTally& TransformTally::getLength(int wordLength) const {
+    return this->lengths[wordLength];
+}
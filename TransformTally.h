@@ -0,0 +1,138 @@
+// Author: Forrest Miller
+// Filename: TransformTally.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef TransformTally_h
+#define TransformTally_h
+
+#include <stdint.h>
+
+//
+// Class Overview:
+//     This class counts the random choices the transforms make, so their
+//     distributions can be measured instead of guessed at. A thread that
+//     wants its transforms counted hands one to
+//     SequenceEnum::setThreadTally(); from then on the transforms report
+//     each choice as they make it:
+//        -computeSeqEnum(): which CHANCE_ band the draw fell in
+//        -addCharacters(): which branch placed each repeated character, and
+//         at what index
+//        -computeSpasEnum(): truncate or concatenate, and the substring's
+//         start and length
+//        -performSeqExtract(): where the removed substring started and its
+//         length
+//     The caller adds which variant it built and how long the result was.
+//     Everything is counted per word length, and under the variant being
+//     built (set with beginTransform()), since SeqExtract and SpasEnum run
+//     the base class's computeSeqEnum() too before replacing its result.
+//     Indexes and lengths past MAX_TALLY_INDEX are counted in the last slot.
+//
+// Valid States include: Holding any number of counts.
+//
+// Anticipated Use:  One per thread of the DistributionProfiler, added
+//                   together at the end.
+//
+// Class Invariants:  -Every count is under the word length and variant
+//                     current when it was made.
+//
+// Assumptions:
+//      -Word lengths are below MAX_TALLY_WORD_LENGTH.
+//      -Only the owning thread counts into a tally.
+//
+// Dependencies: None
+//
+
+const int MAX_TALLY_WORD_LENGTH = 13;   //Lengths 0 to 12
+const int MAX_TALLY_INDEX = 31;         //Indexes and lengths kept apart
+const int TALLY_SLOTS = MAX_TALLY_INDEX + 1;
+const int TALLY_VARIANTS = 3;           //As PuzzleFactory numbers them
+
+//computeSeqEnum()'s bands: how many characters it asked to repeat
+const int TALLY_BAND_ONE = 0;
+const int TALLY_BAND_TWO = 1;
+const int TALLY_BAND_THREE = 2;
+const int TALLY_BAND_FOUR = 3;
+const int TALLY_BAND_FIVE = 4;
+const int TALLY_BAND_WHOLE_WORD = 5;
+//addCharacters()'s branches, one count per character placed
+const int TALLY_ADD_FIRST_DOUBLED = 6;  //First letter repeated in place
+const int TALLY_ADD_LAST_APPENDED = 7;  //Last letter, appended
+const int TALLY_ADD_LAST_INSERTED = 8;  //Last letter, inserted earlier
+const int TALLY_ADD_THREE_LETTER = 9;   //Middle of a 3 letter word
+const int TALLY_ADD_MIDDLE_APPENDED = 10;
+const int TALLY_ADD_MIDDLE_REPLACED = 11; //Overwrites the next letter
+const int TALLY_ADD_MIDDLE_INSERTED = 12;
+const int TALLY_ADD_FROM_WHOLE_WORD = 13; //Appended when repeating it all
+//computeSpasEnum()'s choice
+const int TALLY_SPAS_CONCATENATED = 14;
+const int TALLY_SPAS_TRUNCATED = 15;
+const int NUM_TALLY_OUTCOMES = 16;
+
+struct LengthTally {
+    uint64_t variants[TALLY_VARIANTS];
+    uint64_t outcomes[TALLY_VARIANTS][NUM_TALLY_OUTCOMES];
+    uint64_t insertPositions[TALLY_VARIANTS][TALLY_SLOTS];
+    uint64_t spasStarts[TALLY_SLOTS];
+    uint64_t spasLengths[TALLY_SLOTS];
+    uint64_t extractStarts[TALLY_SLOTS];
+    uint64_t extractLengths[TALLY_SLOTS];
+    uint64_t outputLengths[TALLY_VARIANTS][TALLY_SLOTS];
+};
+
+class TransformTally {
+private:
+    LengthTally lengths[MAX_TALLY_WORD_LENGTH];
+    int variant;
+
+    static int slot(unsigned long index) {
+        return (index > (unsigned long) MAX_TALLY_INDEX) ? MAX_TALLY_INDEX :
+        (int) index;
+    }
+public:
+    TransformTally(void);
+    //Description: Constructs a tally with every count zero
+
+    void beginTransform(int wordLength, int variantBuilt) {
+        this->variant = variantBuilt;
+        this->lengths[wordLength].variants[variantBuilt]++;
+    }
+    //Description: Counts one transform of the variant (DO_SEQ_ENUM, ...)
+    //             and files what it reports under that variant
+
+    void countOutcome(unsigned long wordLength, int outcome) {
+        this->lengths[wordLength].outcomes[this->variant][outcome]++;
+    }
+    //Description: Counts a band, branch or choice (a TALLY_ outcome)
+
+    void countInsertPosition(unsigned long wordLength, unsigned long index) {
+        this->lengths[wordLength].insertPositions[this->variant]
+        [slot(index)]++;
+    }
+    //Description: Counts a repeated character placed at the index
+
+    void countSpasSubstring(unsigned long wordLength, int start, int length) {
+        this->lengths[wordLength].spasStarts[slot((unsigned long) start)]++;
+        this->lengths[wordLength].spasLengths[slot((unsigned long) length)]++;
+    }
+
+    void countExtraction(unsigned long wordLength, unsigned long start,
+                         unsigned long length) {
+        this->lengths[wordLength].extractStarts[slot(start)]++;
+        this->lengths[wordLength].extractLengths[slot(length)]++;
+    }
+
+    void countOutputLength(int wordLength, unsigned long outputLength) {
+        this->lengths[wordLength].outputLengths[this->variant]
+        [slot(outputLength)]++;
+    }
+    //Description: Counts the length of the word the transform emitted
+
+    void add(const TransformTally& other);
+    //Description: Adds every count of the other tally to this one
+
+    const LengthTally& getLength(int wordLength) const;
+    //Description: Returns the counts for words of the length
+};
+
+#endif /* TransformTally_h */
@@ -0,0 +1,194 @@
+// Author: Forrest Miller
+// Filename: WordReader.cpp
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#include "WordReader.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <iostream>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+//
+//      Class Overview:
+//          This .cpp file contains the implementation for the WordReader
+//          class. Both input paths hand out words from a 'window' of bytes:
+//          a mapped file is one window that never changes, while chunked
+//          input slides what is left of the buffer to its front and reads
+//          behind it whenever a word runs past the end.
+//
+//         Class invariants -- See Class invariants in .h file
+//
+
+//--------------------------------------------------------------------
+//  Constants
+//--------------------------------------------------------------------
+const size_t READ_CHUNK_BYTES = 1u << 20; //1 MB per read() from a pipe
+const size_t LENGTH_PREFIX_BYTES = 2u;
+const int NO_FILE = -1;
+
+//--------------------------------------------------------------------
+//  Constructor
+//--------------------------------------------------------------------
+WordReader::WordReader(WordFormat wordFormat) {
+    this->format = wordFormat;
+    this->fd = NO_FILE;
+    this->mapped = nullptr;
+    this->mappedLength = 0u;
+    this->window = nullptr;
+    this->position = 0u;
+    this->windowLength = 0u;
+    this->endOfInput = false;
+    this->failed = false;
+}
+
+WordReader::~WordReader(void) {
+    if (nullptr != this->mapped) {
+        munmap((void *) this->mapped, this->mappedLength);
+    }
+    if (NO_FILE != this->fd && STDIN_FILENO != this->fd) {
+        close(this->fd);
+    }
+}
+
+//--------------------------------------------------------------------
+//  Functions
+//--------------------------------------------------------------------
+bool WordReader::open(const std::string& path) {
+    if ("-" == path) {
+        this->fd = STDIN_FILENO;
+    }
+    else {
+        this->fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    }
+    if (NO_FILE == this->fd) {
+        std::cerr << "Could not open " << path << ": " << strerror(errno)
+        << std::endl;
+        return false;
+    }
+    struct stat info;
+    if (0 == fstat(this->fd, &info) && S_ISREG(info.st_mode) &&
+        info.st_size > 0) {
+        void * map = mmap(nullptr, (size_t) info.st_size, PROT_READ,
+                          MAP_PRIVATE, this->fd, 0);
+        if (MAP_FAILED != map) {
+            madvise(map, (size_t) info.st_size, MADV_SEQUENTIAL);
+            this->mapped = (const char *) map;
+            this->mappedLength = (size_t) info.st_size;
+            this->window = this->mapped;
+            this->windowLength = this->mappedLength;
+            this->endOfInput = true; //Nothing more to read behind the map
+            return true;
+        }
+    } //Pipes, terminals and files that can't be mapped are read in chunks
+    this->buffer.resize(READ_CHUNK_BYTES);
+    this->window = this->buffer.data();
+    return true;
+}
+
+bool WordReader::nextWord(const char *& text, size_t& length) {
+    if (WORD_LENGTH_PREFIXED == this->format) {
+        if (!haveBytes(LENGTH_PREFIX_BYTES)) {
+            if (this->position != this->windowLength) {
+                this->failed = true; //Input stopped inside a length
+            }
+            return false;
+        }
+        const unsigned char * prefix =
+        (const unsigned char *) this->window + this->position;
+        length = (size_t) prefix[0] | ((size_t) prefix[1] << 8);
+        if (!haveBytes(LENGTH_PREFIX_BYTES + length)) {
+            this->failed = true; //Input stopped inside a word
+            return false;
+        }
+        text = this->window + this->position + LENGTH_PREFIX_BYTES;
+        this->position += LENGTH_PREFIX_BYTES + length;
+        return true;
+    }
+    size_t searched = 0u;
+    const char * newline;
+    while (true) {
+        const char * start = this->window + this->position;
+        size_t available = this->windowLength - this->position;
+        newline = (const char *) memchr(start + searched, '\n',
+                                        available - searched);
+        if (nullptr != newline) {
+            break;
+        }
+        searched = available;
+        if (!readMore()) {
+            if (0u == available) {
+                return false;
+            }
+            newline = start + available; //Last line has no '\n'
+            break;
+        }
+    }
+    text = this->window + this->position;
+    length = (size_t) (newline - text);
+    this->position += length + 1u;
+    if (this->position > this->windowLength) {
+        this->position = this->windowLength;
+    }
+    if (length > 0u && '\r' == text[length - 1u]) {
+        length--;
+    }
+    return true;
+}
+
+bool WordReader::hadError(void) const {
+    return this->failed;
+}
+
+//--------------------------------------------------------------------
+// Private Functions
+//--------------------------------------------------------------------
+
+//Moves the unread bytes to the front of the buffer (growing it if they fill
+//it) and reads behind them. Returns false once no more bytes will come.
+bool WordReader::readMore(void) {
+    if (this->endOfInput) {
+        return false;
+    }
+    size_t unread = this->windowLength - this->position;
+    if (this->position > 0u) {
+        memmove(this->buffer.data(), this->buffer.data() + this->position,
+                unread);
+        this->position = 0u;
+        this->windowLength = unread;
+    }
+    if (unread == this->buffer.size()) {
+        this->buffer.resize(this->buffer.size() * 2u);
+    }
+    this->window = this->buffer.data();
+    while (true) {
+        ssize_t got = read(this->fd, this->buffer.data() + unread,
+                           this->buffer.size() - unread);
+        if (got > 0) {
+            this->windowLength += (size_t) got;
+            return true;
+        }
+        if (got < 0 && EINTR == errno) {
+            continue;
+        }
+        if (got < 0) {
+            std::cerr << "read: " << strerror(errno) << std::endl;
+            this->failed = true;
+        }
+        this->endOfInput = true;
+        return false;
+    }
+}
+
+//Returns true once at least 'bytes' unread bytes are in the window
+bool WordReader::haveBytes(size_t bytes) {
+    while (this->windowLength - this->position < bytes) {
+        if (!readMore()) {
+            return false;
+        }
+    }
+    return true;
+}
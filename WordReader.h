@@ -0,0 +1,84 @@
+// Author: Forrest Miller
+// Filename: WordReader.h
+// Most Recent Version Date: October 19, 2026
+// Version:  10/19/2026 Version 1.0
+//
+#ifndef WordReader_h
+#define WordReader_h
+
+#include <stddef.h>
+#include <string>
+#include <vector>
+
+//
+// Class Overview:
+//     This class hands out the words of a large word list one at a time
+//     without copying them or going through iostreams. A regular file is
+//     mapped into memory whole and the words are handed out as pointers into
+//     the mapping; anything else (stdin, a pipe) is read in large chunks
+//     into a buffer that is reused as the list is consumed. Two layouts are
+//     understood:
+//        -WORD_LINES: one word per line ('\n' or "\r\n" endings).
+//        -WORD_LENGTH_PREFIXED: each word is a 2 byte little-endian length
+//         followed by that many bytes, for lists that are generated by other
+//         tools.
+//
+// Valid States include: Not open, open with words left, and finished (either
+//                       at the end of input or after an error).
+//
+// Anticipated Use:  Open once with a path ("-" for stdin) and call nextWord()
+//                   until it returns false, then check hadError().
+//
+// Class Invariants:  -A word handed out stays valid until the next call.
+//
+// Assumptions:
+//      -Words are short (well under the chunk size); a longer line is still
+//       read whole by growing the buffer.
+//
+// Dependencies: None
+//
+
+enum WordFormat {WORD_LINES, WORD_LENGTH_PREFIXED};
+
+class WordReader {
+private:
+    WordFormat format;
+    int fd;
+    const char * mapped;      //Whole file, or nullptr if reading chunks
+    size_t mappedLength;
+    std::vector<char> buffer;
+    const char * window;      //The mapping, or the front of the buffer
+    size_t position;          //Next unread byte of the window
+    size_t windowLength;
+    bool endOfInput;
+    bool failed;
+
+    bool readMore(void);
+    bool haveBytes(size_t bytes);
+
+    WordReader(const WordReader&);
+    WordReader& operator=(const WordReader&);
+public:
+    WordReader(WordFormat format);
+    //Description: Constructs a reader for the given layout, not yet open
+
+    ~WordReader(void);
+    //Description: Unmaps and closes the input
+
+    bool open(const std::string& path);
+    //Description: Opens the word list, mapping it if it is a regular file
+    //Preconditions: Not already open. "-" means stdin.
+    //Postconditions: Returns false (after printing why) if it can't be read
+
+    bool nextWord(const char *& text, size_t& length);
+    //Description: Points text at the next word (which may be empty, for a
+    //             blank line) and sets its length
+    //Preconditions: open() succeeded
+    //Postconditions: Returns false once the words run out or on an error
+
+    bool hadError(void) const;
+    //Description: Returns true if reading stopped because of an error or a
+    //             truncated length-prefixed record
+};
+
+#endif /* WordReader_h */
@@ -10,10 +10,45 @@
 #include "SequenceEnum.h"
 #include "SeqExtract.h"
 #include "SpasEnum.h"
+#include "Dictionary.h"
+#include "FastRandom.h"
+#include "Corpus.h"
+#include "EpochCorpus.h"
+#include "PuzzlePool.h"
+#include "Puzzle.h"
+#include "GameSession.h"
+#include "GameServer.h"
+#include "TerminalChannel.h"
+#include "ScriptedChannel.h"
+#include "LoadGenerator.h"
+#include "BatchEncryptor.h"
+#include "GuessGrader.h"
+#include "RecordPipeline.h"
+#include "PuzzleFactory.h"
+#include "EventLog.h"
+#include "EventAggregator.h"
+#include "Instrumentation.h"
+#include "Tracer.h"
+#include "BenchRunner.h"
+#include "BenchComparator.h"
+#include "AllocationTracker.h"
+#include "MemoryFootprint.h"
+#include "StartupTimer.h"
+#include "SessionRecording.h"
+#include "RecordingChannel.h"
+#include "SessionReplayer.h"
+#include "SamplingProfiler.h"
+#include "DistributionProfiler.h"
 #include <stdint.h>//Allows for the additional integer types (uint,uint8_t,etc)
 #include <stdio.h>      /* printf, NULL */
 #include <stdlib.h> /* Random Number Generation */
 #include <vector>
+#include <iterator>
+#include <chrono>
+#include <fstream>
+#include <signal.h>
+#include <unistd.h>
+#include <thread>
 
 using std::string;
 using std::cout;
@@ -84,11 +119,7 @@ using std::cout;
 
 const int MAX_PREDEFINED_WORD_LENGTH = 13; //This is for array to hold count of
 //                                         words of each length
-const int MAX_GUESSES = 3;
-const int DO_SEQ_ENUM = 0;
-const int DO_SEQ_EXTRACT = 1;
-const int SECND_LTR_OF_WRD_INDX = 1; //string.at(1) is second letter
-const int SEQ_ENUM_VARIANTS = 3; //3 types of sequence enum
+//MAX_GUESSES is shared with the server's sessions, see GameSession.h
 const int ZERO_LETTERS = 0;
 const int ONE_LETTER = 1;
 const int TWO_LETTERS = 2;
@@ -102,8 +133,51 @@ const int NINE_LETTERS = 9;
 const int TEN_LETTERS = 10;
 const int ELEVEN_LETTERS = 11;
 const int TWELVE_LETTERS = 12;
-const float ONE_HUNDRED_PERCENT = 100.0;
-const float FIFTY_PERCENT = 50.0;
+const std::chrono::milliseconds CORPUS_REFRESH_INTERVAL(60000); //1 minute
+const int NO_SERVE_PORT = 0;
+const unsigned int NO_LOAD_TEST = 0u;
+const int DEFAULT_LOAD_TEST_ROUNDS = 10;
+
+//--------------------------------------------------------------------
+//  Command Line Options
+//--------------------------------------------------------------------
+struct ProgramOptions {
+    int servePort = NO_SERVE_PORT;      //--serve-tcp PORT
+    string servePath;                   //--serve-unix PATH
+    unsigned int serveThreads = 0u;     //--threads N (0 = one per core)
+    string scriptPath;                  //--script FILE
+    unsigned int loadBots = NO_LOAD_TEST; //--load-test BOTS
+    int loadRounds = DEFAULT_LOAD_TEST_ROUNDS; //--rounds N (per bot)
+    string loadStrategy = "mixed";      //--strategy oracle|random|solver|mixed
+    string encryptPath;                 //--encrypt FILE ("-" for stdin)
+    bool encryptBinary = false;         //--binary (length-prefixed words)
+    string encryptTransform = "random"; //--transform enum|extract|spas|random
+    string gradePath;                   //--grade FILE ("-" for stdin)
+    string eventLogPath;                //--event-log DIR
+    string aggregatePath;               //--aggregate DIR
+    string latencyJsonPath;             //--latency-json FILE
+    string tracePath;                   //--trace FILE
+    double traceSampleRate = 1.0;       //--trace-sample RATE (of sessions)
+    bool bench = false;                 //--bench
+    bool benchPerf = false;             //--perf (hardware counters)
+    int benchReps = DEFAULT_BENCH_REPS; //--reps N
+    uint64_t benchSeed = DEFAULT_BENCH_SEED; //--seed N
+    string benchJsonPath;               //--bench-json FILE
+    string compareBaseline;             //--compare BASELINE CANDIDATE
+    string compareCandidate;
+    //--threshold PERCENT
+    double regressionThreshold = DEFAULT_REGRESSION_THRESHOLD;
+    bool footprint = false;             //--footprint
+    bool fastStart = false;             //--fast-start
+    bool startupBench = false;          //--startup-bench
+    string recordPath;                  //--record FILE
+    string replayPath;                  //--replay FILE
+    string profilePath;                 //--profile FILE (folded stacks)
+    int profileHz = DEFAULT_PROFILE_HZ; //--profile-hz N
+    bool distribution = false;          //--distribution
+    //--samples N (per word length)
+    uint64_t distributionSamples = DEFAULT_DISTRIBUTION_SAMPLES;
+};
 
 //static const string longWord = "Floccinaucinihilipilification";
 
@@ -111,6 +185,10 @@ const float FIFTY_PERCENT = 50.0;
 //                flawlessly and to keep the driver's game interesting. Please
 //                just skip past these massive static arrays of words
 
+//Static initialization of the word arrays is the first phase of startup
+static const std::chrono::steady_clock::time_point wordArraysStarted =
+StartupTimer::origin();
+
 static const string wrd3Ltr[] ={"ace", "ant", "are", "axe", "bar", "bed", "bag",
     "bat", "bow", "bus", "bug", "can", "car", "cat", "cub", "cup", "dig", "dog",
     "dug", "duo", "eat", "eve", "fad", "far", "fur", "fun", "fix", "gap", "gig",
@@ -636,17 +714,54 @@ static const string wrd12Ltr[] = {"extravaganza", "embezzlement",
     "fabrications", "quantization", "inexplicable", "colloquially",
     "preoccupancy", "equivalently", "majestically",
 }; //more words here too
+static const std::chrono::steady_clock::time_point wordArraysBuilt =
+std::chrono::steady_clock::now();
 
 //--------------------------------------------------------------------
 //  Function Prototypes
 //--------------------------------------------------------------------
-void printWelcome(void);
-void printFarewell(int correct, int incorrect);
-int getUserInputInt(string&);
-void clearInputStream(void);
-//void doUserGuess(SequenceEnum&, int&, int&); //Object slicing ruined my day
-void doUserGuess(SequenceEnum*, int&, int&); //Luckily, pointers to the rescue
+//The game's rules now live in GameSession::play(), a coroutine that runs the
+//same way on the terminal, from a script, or inside the server
 void countWordsOfEachLength(int *);
+void buildDictionary(Dictionary&, const int *);
+bool parseOptions(int argc, const char * argv[], ProgramOptions&);
+int runScript(EpochCorpus&, FastRandom&, const ProgramOptions&);
+int runLoadTest(EpochCorpus&, const Dictionary&, uint64_t seed,
+                const ProgramOptions&);
+int runServer(EpochCorpus&, uint64_t seed, const ProgramOptions&,
+              const sigset_t& stopSignals);
+int runBatchEncrypt(const ProgramOptions&);
+int runGrader(EpochCorpus&, const Dictionary&, const ProgramOptions&);
+int runAggregate(const string& directory);
+int runCompare(const ProgramOptions&);
+int runRecord(EpochCorpus&, uint64_t corpusSeed, uint64_t sessionSeed,
+              const ProgramOptions&);
+int runReplay(EpochCorpus&, const SessionRecording&, const ProgramOptions&);
+void dumpLatencies(const ProgramOptions&);
+int runBench(const string * const wordArrays[], const int * numWords,
+             const ProgramOptions&);
+int runFootprint(const string * const wordArrays[], const int * numWords,
+                 const Dictionary&, EpochCorpus&);
+int runDistribution(const string * const wordArrays[], const int * numWords,
+                    const ProgramOptions&);
+void buildFirstCorpus(Dictionary&, const string * const wordArrays[],
+                      const int * numWords, EpochCorpus&, uint64_t seed);
+
+//Finishes the profile and the trace and dumps the latency probes (and
+//allocation counts) when main() returns, whichever mode it ran
+struct ShutdownReports {
+    const ProgramOptions& options;
+    ~ShutdownReports(void) {
+        SamplingProfiler::stop();
+        Tracer::stop();
+        dumpLatencies(this->options);
+        if (AllocationTracker::isEnabled()) {
+            AllocationTracker::report(std::cerr);
+        }
+    }
+};
+int runRecordJob(const RecordProcessor&, WordReader&, unsigned int threads,
+                 uint64_t seed);
 
 
 //--------------------------------------------------------------------
@@ -654,652 +769,649 @@ void countWordsOfEachLength(int *);
 //--------------------------------------------------------------------
 int main(int argc, const char * argv[]) {
     //Variables for main()
-    float percentCorrect = 0.0;
-    bool keepPlaying = true;
-    int correctGuesses = 0;
-    int incorrectGuesses = 0;
-    int substrLength = 0; //Used in seqExtract
-    int substrStartIndex = 0; //Used in seqExtract
-    int sequenceEnumToDo;
-    int userInputInt; //User input when user input is an integer
-    int randomWordInVector;
-    //string userInputStr;
     int numWordsOfEachLength [MAX_PREDEFINED_WORD_LENGTH];
-    string userPromptForWordLength = "Enter number of letters for guessWord"
-    " [3 - 12, or 0 to quit]:";
+    ProgramOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        return EXIT_FAILURE;
+    }
+    ShutdownReports shutdownReports = {options};
+    bool serving = (NO_SERVE_PORT != options.servePort ||
+                    !options.servePath.empty());
+    //Every thread started below inherits this mask, so in server mode only
+    //the sigwait() in runServer() ever sees Ctrl-C or a kill
+    sigset_t stopSignals;
+    sigemptyset(&stopSignals);
+    sigaddset(&stopSignals, SIGINT);
+    sigaddset(&stopSignals, SIGTERM);
+    if (serving) {
+        signal(SIGINT, SIG_DFL); //Background shells start us with it ignored,
+        signal(SIGTERM, SIG_DFL); //and sigwait() never sees ignored signals
+        pthread_sigmask(SIG_BLOCK, &stopSignals, nullptr);
+    }
+    //Started after the mask so the flusher thread inherits it too
+    if (!options.tracePath.empty() &&
+        !Tracer::start(options.tracePath, options.traceSampleRate)) {
+        return EXIT_FAILURE;
+    }
+    //Likewise the profiler's folding thread. SIGUSR2 pauses and resumes it.
+    if (!options.profilePath.empty() &&
+        !SamplingProfiler::start(options.profilePath, options.profileHz)) {
+        return EXIT_FAILURE;
+    }
     
     //------------------------------------------------------------------------
     //Initialization Routines
     //------------------------------------------------------------------------
     //Set Random Seed
     srand((uint)time(NULL));
+    //Batch encryption works on its own word list, so it doesn't need the
+    //dictionary or a corpus built first
+    if (!options.encryptPath.empty()) {
+        return runBatchEncrypt(options);
+    }
+    if (!options.aggregatePath.empty()) { //Only reads the logs
+        return runAggregate(options.aggregatePath);
+    }
+    if (!options.compareBaseline.empty()) { //Only reads the results
+        return runCompare(options);
+    }
     
     //Figure out how many words of each length there are to choose from
+    StartupTimer::record("static word arrays", wordArraysStarted,
+                         wordArraysBuilt);
+    StartupPhase countPhase("count words");
     countWordsOfEachLength(numWordsOfEachLength);
+    countPhase.end();
     //This next bit of logic may seem confusing, if I was allowed to use integer
     //literals instead of hiding them behind constants for word index values
     //that will NEVER change, it probably would be easier to follow. Oh well...
     
     //Generate a large collection of sequenceEnum objects for each word lengths
-    //I used 'rand() % 3' to decide which type of object to construct for each
-    //word. I construct all the objects up front during initialization
-    std::vector<SequenceEnum *> wordHolder3Ltr; //word holder for 3-letter words
-    for (string s : wrd3Ltr) { //For each string in wrd3Ltr
-        sequenceEnumToDo = rand() % SEQ_ENUM_VARIANTS; //3 variants currently
-        if (DO_SEQ_ENUM == sequenceEnumToDo) {
-            //Vector will keep ref to heap memory, I will delete during cleanup
-            SequenceEnum * temp = new SequenceEnum(s);
-            wordHolder3Ltr.push_back(temp); //Do sequence Enum
-        }
-        else if (DO_SEQ_EXTRACT == sequenceEnumToDo) {
-            //Need to compute a sequence extract string. here it is easy, since
-            string substr = ""; //For 3 letter words, only extract middle letter
-            substr += s.at(SECND_LTR_OF_WRD_INDX);
-            SeqExtract * temp = new SeqExtract(s, substr); //Construct object
-            wordHolder3Ltr.push_back( temp);
-        }
-        else { //if (DO_SPAS_ENUM == sequenceEnumToDo)
-            SpasEnum * temp = new SpasEnum(s);
-            wordHolder3Ltr.push_back(temp); //do SpasEnum
-        }
+    //PuzzleFactory::randomVariant() draws from the thread's FastRandom to
+    //decide which type of object to construct for each word. The corpus
+    //constructs all the objects up front, works out which puzzles have more
+    //than one valid answer, and builds an alias table per word length so
+    //each round's selection is O(1)
+    const string * wordArrays[MAX_PREDEFINED_WORD_LENGTH] = {
+        nullptr, nullptr, nullptr, wrd3Ltr, wrd4Ltr, wrd5Ltr, wrd6Ltr, wrd7Ltr,
+        wrd8Ltr, wrd9Ltr, wrd10Ltr, wrd11Ltr, wrd12Ltr};
+    if (options.bench) { //Benchmarks build their own objects from the words
+        return runBench(wordArrays, numWordsOfEachLength, options);
+    }
+    if (options.distribution) {
+        return runDistribution(wordArrays, numWordsOfEachLength, options);
     }
-    std::vector<SequenceEnum *> wordHolder4Ltr; //word holder for 4 letter words
-    for (string s : wrd4Ltr) {
-        sequenceEnumToDo = rand() % SEQ_ENUM_VARIANTS;
-        if (DO_SEQ_ENUM == sequenceEnumToDo) {
-            SequenceEnum * temp = new SequenceEnum(s);
-            wordHolder4Ltr.push_back(temp); //Do sequence Enum
+    Dictionary dictionary;
+    FastRandom selectionRng((uint64_t) time(NULL));
+    uint64_t firstCorpusSeed = selectionRng.next();
+    uint64_t refreshSeed = selectionRng.next();
+    //A replay builds the corpus the recorded game was played on
+    SessionRecording replaying;
+    if (!options.replayPath.empty()) {
+        if (!replaying.load(options.replayPath)) {
+            return EXIT_FAILURE;
         }
-        else if (DO_SEQ_EXTRACT == sequenceEnumToDo) {
-            string substr;
-            substrStartIndex = (rand() % (FOUR_LETTERS - SECND_LTR_OF_WRD_INDX))
-            + SECND_LTR_OF_WRD_INDX; //(rand() % (4-1)) + 1    will equal 1 or 2
-            if (substrStartIndex > SECND_LTR_OF_WRD_INDX) {
-                substrLength = SECND_LTR_OF_WRD_INDX; //aka substrLength = 1
-            }
-            else {
-                substrLength = rand() % SECND_LTR_OF_WRD_INDX;
+        firstCorpusSeed = replaying.getCorpusSeed();
+    }
+    //Refreshes happen on a timer, so recorded and replayed games go without
+    bool refresh = options.recordPath.empty() && options.replayPath.empty();
+    EpochCorpus corpusEpochs;
+    //With --fast-start the game's first prompt goes up while the dictionary
+    //and the first corpus are built in the background. The first round
+    //waits for them if they aren't done by then. The modes that use the
+    //corpus right away always build it first.
+    bool deferBuild = options.fastStart && NO_LOAD_TEST == options.loadBots &&
+                      options.gradePath.empty() && !options.footprint &&
+                      options.replayPath.empty();
+    std::thread deferredBuild;
+    if (deferBuild) {
+        deferredBuild = std::thread([&]() {
+            buildFirstCorpus(dictionary, wordArrays, numWordsOfEachLength,
+                             corpusEpochs, firstCorpusSeed);
+            if (refresh) {
+                corpusEpochs.startRefreshing(wordArrays, numWordsOfEachLength,
+                                             MAX_PREDEFINED_WORD_LENGTH,
+                                             dictionary, refreshSeed,
+                                             CORPUS_REFRESH_INTERVAL);
             }
-            substr = s.substr(substrStartIndex, substrLength);
-            SeqExtract * temp = new SeqExtract(s, substr);
-            wordHolder4Ltr.push_back(temp);
+        });
+    }
+    else {
+        buildFirstCorpus(dictionary, wordArrays, numWordsOfEachLength,
+                         corpusEpochs, firstCorpusSeed);
+        if (!options.gradePath.empty()) { //Grades against this first corpus
+            return runGrader(corpusEpochs, dictionary, options);
         }
-        else { //if DO_SPAS_ENUM == sequenceEnumToDo
-            SpasEnum * temp = new SpasEnum(s);
-            wordHolder4Ltr.push_back(temp); //Do sequence Enum
+        if (options.footprint) {
+            return runFootprint(wordArrays, numWordsOfEachLength, dictionary,
+                                corpusEpochs);
         }
-    }
-    std::vector<SequenceEnum *> wordHolder5Ltr; //Create vec for 5 letter words
-    for (string s : wrd5Ltr) {
-        sequenceEnumToDo = rand() % SEQ_ENUM_VARIANTS;
-        if (DO_SEQ_ENUM == sequenceEnumToDo) {
-            SequenceEnum * temp = new SequenceEnum(s);
-            wordHolder5Ltr.push_back(temp); //Do sequence Enum
+        if (!options.replayPath.empty()) {
+            return runReplay(corpusEpochs, replaying, options);
         }
-        else if (DO_SEQ_EXTRACT == sequenceEnumToDo) {
-            string substr;
-            substrStartIndex = (rand() % (FIVE_LETTERS - SECND_LTR_OF_WRD_INDX))
-            + SECND_LTR_OF_WRD_INDX; //(rand() % (5-1)) + 1
-            if (substrStartIndex > SECND_LTR_OF_WRD_INDX) {
-                substrLength = (rand() % SECND_LTR_OF_WRD_INDX) +
-                SECND_LTR_OF_WRD_INDX; //1 or 2
-                //Need to make sure substrLength isn't too long though
-                if (substrLength + substrStartIndex > FIVE_LETTERS) {
-                    substrLength = FIVE_LETTERS - substrStartIndex;
-                }
-            }
-            else {
-                substrLength = (rand() % THREE_LETTERS) + SECND_LTR_OF_WRD_INDX;
-            }
-            substr = s.substr(substrStartIndex, substrLength);
-            SeqExtract * temp = new SeqExtract(s, substr);
-            wordHolder5Ltr.push_back(temp);
+        //Re-randomize every puzzle periodically. New corpora are built in the
+        //background and swapped in whole, so a round never sees a partial one
+        if (refresh) {
+            corpusEpochs.startRefreshing(wordArrays, numWordsOfEachLength,
+                                         MAX_PREDEFINED_WORD_LENGTH,
+                                         dictionary, refreshSeed,
+                                         CORPUS_REFRESH_INTERVAL);
         }
-        else { //if DO_SPAS_ENUM == sequenceEnumToDo
-            SpasEnum* temp = new SpasEnum(s);
-            wordHolder5Ltr.push_back(temp);
+    }
+    //The refresher can only be stopped once the deferred build started it
+    auto stopCorpus = [&]() {
+        if (deferredBuild.joinable()) {
+            deferredBuild.join();
         }
+        corpusEpochs.stopRefreshing();
+    };
+    if (serving) {
+        int status = runServer(corpusEpochs, selectionRng.next(), options,
+                               stopSignals);
+        stopCorpus();
+        return status;
+    }
+    if (NO_LOAD_TEST != options.loadBots) {
+        int status = runLoadTest(corpusEpochs, dictionary, selectionRng.next(),
+                                 options);
+        stopCorpus();
+        return status;
+    }
+    if (!options.scriptPath.empty()) {
+        int status = runScript(corpusEpochs, selectionRng, options);
+        stopCorpus();
+        return status;
+    }
+    if (!options.recordPath.empty()) {
+        int status = runRecord(corpusEpochs, firstCorpusSeed,
+                               selectionRng.next(), options);
+        stopCorpus();
+        return status;
+    }
+    int gameReaderSlot = corpusEpochs.registerReader();
+    
+    //Keep a pool of freshly encrypted puzzles topped up in the background so
+    //that drawing the same word twice doesn't show the same encryption
+    StartupPhase poolPhase("start puzzle pool");
+    PuzzlePool puzzlePool(corpusEpochs, dictionary, selectionRng.next());
+    puzzlePool.start();
+    poolPhase.end();
+    StartupTimer::record("to first prompt", StartupTimer::origin(),
+                         std::chrono::steady_clock::now());
+    if (options.startupBench) { //Stops where the first prompt would go up
+        stopCorpus();
+        puzzlePool.stop();
+        corpusEpochs.unregisterReader(gameReaderSlot);
+        StartupTimer::report(cout);
+        return EXIT_SUCCESS;
+    }
+    
+    //-------------------------------------------------------------------
+    //Start
+    //-------------------------------------------------------------------
+    //Nothing ever has to wait for input on the terminal, so the whole game
+    //runs inside this call
+    EventLog events(options.eventLogPath, 0);
+    if (!options.eventLogPath.empty()) {
+        events.open(); //Plays on unlogged if the log can't be created
     }
-    std::vector<SequenceEnum *> wordHolder6Ltr; //6 letter words
-    for (string s : wrd6Ltr) {
-        sequenceEnumToDo = rand() % SEQ_ENUM_VARIANTS;
-        if (DO_SEQ_ENUM == sequenceEnumToDo) {
-            SequenceEnum * temp = new SequenceEnum(s);
-            wordHolder6Ltr.push_back(temp); //Do sequence Enum
+    TerminalChannel terminal;
+    GameSession session(corpusEpochs, gameReaderSlot, selectionRng,
+                        &puzzlePool, &events);
+    GameTask game = session.play(terminal);
+    
+    //-------------------------------------------------------------------
+    // Clean-Up (the corpora are owned and deleted by corpusEpochs)
+    //-------------------------------------------------------------------
+    stopCorpus(); //Before the pool, whose producer may wait on the corpus
+    puzzlePool.stop();
+    corpusEpochs.unregisterReader(gameReaderSlot);
+    return EXIT_SUCCESS;
+}
+
+//This function puts the number of words in each array of words of a certain
+//length into a seperate array to keep track of their lengths. The sizes are
+//known when compiling, so startup doesn't count (or copy) a single word.
+void countWordsOfEachLength(int * lengthsArray) {
+    lengthsArray[ZERO_LETTERS] = 0; //There are no 0 letter words
+    lengthsArray[ONE_LETTER] = 0; //There are no 1 letter words
+    lengthsArray[TWO_LETTERS] = 0; //There are no 2 letter words
+    lengthsArray[THREE_LETTERS] = (int) std::size(wrd3Ltr);
+    lengthsArray[FOUR_LETTERS] = (int) std::size(wrd4Ltr);
+    lengthsArray[FIVE_LETTERS] = (int) std::size(wrd5Ltr);
+    lengthsArray[SIX_LETTERS] = (int) std::size(wrd6Ltr);
+    lengthsArray[SEVEN_LETTERS] = (int) std::size(wrd7Ltr);
+    lengthsArray[EIGHT_LETTERS] = (int) std::size(wrd8Ltr);
+    lengthsArray[NINE_LETTERS] = (int) std::size(wrd9Ltr);
+    lengthsArray[TEN_LETTERS] = (int) std::size(wrd10Ltr);
+    lengthsArray[ELEVEN_LETTERS] = (int) std::size(wrd11Ltr);
+    lengthsArray[TWELVE_LETTERS] = (int) std::size(wrd12Ltr);
+}
+
+//Adds every word from the static word arrays to the dictionary, which drops the
+//duplicates and makes the words searchable by length and by value
+void buildDictionary(Dictionary& dictionary, const int * lengthsArray) {
+    AllocationScope scope(ALLOC_DICTIONARY);
+    dictionary.addWords(wrd3Ltr, lengthsArray[THREE_LETTERS]);
+    dictionary.addWords(wrd4Ltr, lengthsArray[FOUR_LETTERS]);
+    dictionary.addWords(wrd5Ltr, lengthsArray[FIVE_LETTERS]);
+    dictionary.addWords(wrd6Ltr, lengthsArray[SIX_LETTERS]);
+    dictionary.addWords(wrd7Ltr, lengthsArray[SEVEN_LETTERS]);
+    dictionary.addWords(wrd8Ltr, lengthsArray[EIGHT_LETTERS]);
+    dictionary.addWords(wrd9Ltr, lengthsArray[NINE_LETTERS]);
+    dictionary.addWords(wrd10Ltr, lengthsArray[TEN_LETTERS]);
+    dictionary.addWords(wrd11Ltr, lengthsArray[ELEVEN_LETTERS]);
+    dictionary.addWords(wrd12Ltr, lengthsArray[TWELVE_LETTERS]);
+}
+
+//Builds the dictionary and the first corpus and publishes it. Runs in the
+//background with --fast-start.
+void buildFirstCorpus(Dictionary& dictionary, const string * const wordArrays[],
+                      const int * numWords, EpochCorpus& corpusEpochs,
+                      uint64_t seed) {
+    StartupPhase dictionaryPhase("build dictionary");
+    buildDictionary(dictionary, numWords);
+    dictionaryPhase.end();
+    StartupPhase corpusPhase("build first corpus");
+    Corpus * firstCorpus = new Corpus(wordArrays, numWords,
+                                      MAX_PREDEFINED_WORD_LENGTH);
+    firstCorpus->build(dictionary, seed);
+    corpusEpochs.publish(firstCorpus);
+}
+
+//Reads the command line options. Returns false (after printing the usage) if
+//an option is unknown or is missing its value.
+bool parseOptions(int argc, const char * argv[], ProgramOptions& options) {
+    for (int i = 1; i < argc; i++) {
+        string option = argv[i];
+        bool haveValue = (i + 1 < argc);
+        if ("--serve-tcp" == option && haveValue) {
+            options.servePort = atoi(argv[++i]);
         }
-        else if (DO_SEQ_EXTRACT == sequenceEnumToDo) {
-            //Gotta figure out a substring from the word to have removed
-            string substr;
-            //Calculate substring start index
-            substrStartIndex = (rand() % (SIX_LETTERS - SECND_LTR_OF_WRD_INDX))
-            + SECND_LTR_OF_WRD_INDX; //(rand() % (6-1)) + 1
-            //Calculate substring length based off of word length and start indx
-            if (substrStartIndex > SECND_LTR_OF_WRD_INDX) {
-                substrLength = rand() % (SIX_LETTERS - SECND_LTR_OF_WRD_INDX -
-                                         (FIVE_LETTERS - substrStartIndex)) +
-                SECND_LTR_OF_WRD_INDX;
-                //Need to make sure substrLength isn't too long
-                if ( (substrLength + substrStartIndex) > SIX_LETTERS) {
-                    substrLength = SIX_LETTERS - substrStartIndex;
-                }
-            }
-            else {
-                substrLength = (rand() % FOUR_LETTERS) + SECND_LTR_OF_WRD_INDX;
-            }
-            substr = s.substr(substrStartIndex, substrLength); //Get substring
-            SeqExtract * temp = new SeqExtract(s, substr);
-            wordHolder6Ltr.push_back(temp);
+        else if ("--serve-unix" == option && haveValue) {
+            options.servePath = argv[++i];
         }
-        else { //if DO_SPAS_ENUM == sequenceEnumToDo
-            SpasEnum * temp = new SpasEnum(s);
-            wordHolder6Ltr.push_back(temp);
+        else if ("--threads" == option && haveValue) {
+            options.serveThreads = (unsigned int) atoi(argv[++i]);
         }
-    }
-    std::vector<SequenceEnum *> wordHolder7Ltr;
-    for (string s : wrd7Ltr) {
-        sequenceEnumToDo = rand() % SEQ_ENUM_VARIANTS;
-        if (DO_SEQ_ENUM == sequenceEnumToDo) {
-            SequenceEnum * temp = new SequenceEnum(s);
-            wordHolder7Ltr.push_back(temp); //Do sequence Enum
+        else if ("--script" == option && haveValue) {
+            options.scriptPath = argv[++i];
         }
-        else if (DO_SEQ_EXTRACT == sequenceEnumToDo) {
-            //Gotta figure out a substring from the word to have removed
-            string substr;
-            //Calculate substring start index
-            substrStartIndex = (rand() %(SEVEN_LETTERS - SECND_LTR_OF_WRD_INDX))
-            + SECND_LTR_OF_WRD_INDX; //(rand() % (7-1)) + 1
-            //Calculate substring length based off of word length and start indx
-            if (substrStartIndex > SECND_LTR_OF_WRD_INDX) {
-                substrLength = (rand() % THREE_LETTERS) + SECND_LTR_OF_WRD_INDX;
-                //Need to make sure substrLength isn't too long
-                if ( (substrLength + substrStartIndex) > SEVEN_LETTERS) {
-                    substrLength = SEVEN_LETTERS - substrStartIndex;
-                }
-            }
-            else {
-                substrLength = (rand() % FOUR_LETTERS) + SECND_LTR_OF_WRD_INDX;
-            }
-            substr = s.substr(substrStartIndex, substrLength); //Get substring
-            SeqExtract * temp = new SeqExtract(s, substr);
-            wordHolder7Ltr.push_back(temp);
+        else if ("--load-test" == option && haveValue) {
+            options.loadBots = (unsigned int) atoi(argv[++i]);
         }
-        else { //if DO_SPAS_ENUM == sequenceEnumToDo
-            SpasEnum * temp = new SpasEnum(s);
-            wordHolder7Ltr.push_back(temp);
+        else if ("--rounds" == option && haveValue) {
+            options.loadRounds = atoi(argv[++i]);
         }
-    }
-    std::vector<SequenceEnum *> wordHolder8Ltr;
-    for (string s : wrd8Ltr) {
-        sequenceEnumToDo = rand() % SEQ_ENUM_VARIANTS;
-        if (DO_SEQ_ENUM == sequenceEnumToDo) {
-            SequenceEnum * temp = new SequenceEnum(s);
-            wordHolder8Ltr.push_back(temp); //Do sequence Enum
+        else if ("--strategy" == option && haveValue) {
+            options.loadStrategy = argv[++i];
         }
-        else if (DO_SEQ_EXTRACT == sequenceEnumToDo) {
-            //Gotta figure out a substring from the word to have removed
-            string substr;
-            //Calculate substring start index
-            substrStartIndex = (rand() %(EIGHT_LETTERS - SECND_LTR_OF_WRD_INDX))
-            + SECND_LTR_OF_WRD_INDX; //(rand() % (8-1)) + 1
-            //Calculate substring length based off of word length and start indx
-            if (substrStartIndex > SECND_LTR_OF_WRD_INDX) {
-                substrLength = (rand() % THREE_LETTERS) + SECND_LTR_OF_WRD_INDX;
-                //Need to make sure substrLength isn't too long
-                if ( (substrLength + substrStartIndex) > EIGHT_LETTERS) {
-                    substrLength = EIGHT_LETTERS - substrStartIndex; //8 - start
-                }
-            }
-            else {
-                substrLength = (rand() % FOUR_LETTERS) + SECND_LTR_OF_WRD_INDX;
-            }
-            substr = s.substr(substrStartIndex, substrLength); //Get substring
-            SeqExtract * temp = new SeqExtract(s, substr);
-            wordHolder8Ltr.push_back(temp);
+        else if ("--encrypt" == option && haveValue) {
+            options.encryptPath = argv[++i];
         }
-        else { //if DO_SPAS_ENUM == sequenceEnumToDo
-            SpasEnum * temp = new SpasEnum(s);
-            wordHolder8Ltr.push_back(temp);
+        else if ("--binary" == option) {
+            options.encryptBinary = true;
         }
-    }
-    std::vector<SequenceEnum *> wordHolder9Ltr;
-    for (string s : wrd9Ltr) { //Range based for loops are very handy
-        sequenceEnumToDo = rand() % SEQ_ENUM_VARIANTS;
-        if (DO_SEQ_ENUM == sequenceEnumToDo) {
-            SequenceEnum * temp = new SequenceEnum(s);
-            wordHolder9Ltr.push_back(temp); //Do sequence Enum
+        else if ("--transform" == option && haveValue) {
+            options.encryptTransform = argv[++i];
         }
-        else if (DO_SEQ_EXTRACT == sequenceEnumToDo) {
-            //Gotta figure out a substring from the word to have removed
-            string substr;
-            //Calculate substring start index
-            substrStartIndex = (rand() %(NINE_LETTERS - SECND_LTR_OF_WRD_INDX))
-            + SECND_LTR_OF_WRD_INDX; //(rand() % (9 - 1)) + 1
-            //Calculate substring length based off of word length and start indx
-            if (substrStartIndex > SECND_LTR_OF_WRD_INDX) {
-                substrLength = (rand() % THREE_LETTERS) + SECND_LTR_OF_WRD_INDX;
-                //Need to make sure substrLength isn't too long
-                if ( (substrLength + substrStartIndex) > NINE_LETTERS) {
-                    substrLength = NINE_LETTERS - substrStartIndex; //9 - start
-                }
-            }
-            else { //I am keeping the length low here so that the words are not
-                //   impossible to guess
-                substrLength = (rand() % FIVE_LETTERS) + SECND_LTR_OF_WRD_INDX;
-            }
-            substr = s.substr(substrStartIndex, substrLength); //Get substring
-            SeqExtract * temp = new SeqExtract(s, substr);
-            wordHolder9Ltr.push_back(temp);
+        else if ("--grade" == option && haveValue) {
+            options.gradePath = argv[++i];
         }
-        else { //if DO_SPAS_ENUM == sequenceEnumToDo
-            SpasEnum * temp = new SpasEnum(s);
-            wordHolder9Ltr.push_back(temp);
+        else if ("--event-log" == option && haveValue) {
+            options.eventLogPath = argv[++i];
         }
-    }
-    std::vector<SequenceEnum *> wordHolder10Ltr;
-    for (string s : wrd10Ltr) {
-        sequenceEnumToDo = rand() % SEQ_ENUM_VARIANTS;
-        if (DO_SEQ_ENUM == sequenceEnumToDo) {
-            SequenceEnum * temp = new SequenceEnum(s);
-            wordHolder10Ltr.push_back(temp); //Do sequence Enum
+        else if ("--aggregate" == option && haveValue) {
+            options.aggregatePath = argv[++i];
         }
-        else if (DO_SEQ_EXTRACT == sequenceEnumToDo) {
-            //Gotta figure out a substring from the word to have removed
-            string substr;
-            //Calculate substring start index
-            substrStartIndex = (rand() %(TEN_LETTERS - SECND_LTR_OF_WRD_INDX))
-            + SECND_LTR_OF_WRD_INDX; //(rand() % (10 - 1)) + 1
-            //Calculate substring length based off of word length and start indx
-            if (substrStartIndex > SECND_LTR_OF_WRD_INDX) {
-                substrLength = (rand() % THREE_LETTERS) + SECND_LTR_OF_WRD_INDX;
-                //Need to make sure substrLength isn't too long
-                if ( (substrLength + substrStartIndex) > TEN_LETTERS) {
-                    substrLength = TEN_LETTERS - substrStartIndex; //10 - start
-                }
-            }
-            else { //I am keeping the length low here so that the words are not
-                //   impossible to guess
-                substrLength = (rand() % FIVE_LETTERS) + SECND_LTR_OF_WRD_INDX;
-            }
-            substr = s.substr(substrStartIndex, substrLength); //Get substring
-            SeqExtract * temp = new SeqExtract(s, substr);
-            wordHolder10Ltr.push_back(temp);
+        else if ("--latency-json" == option && haveValue) {
+            options.latencyJsonPath = argv[++i];
         }
-        else { //if DO_SPAS_ENUM == sequenceEnumToDo
-            SpasEnum * temp = new SpasEnum(s);
-            wordHolder10Ltr.push_back(temp);
+        else if ("--bench" == option) {
+            options.bench = true;
         }
-    }
-    std::vector<SequenceEnum *> wordHolder11Ltr;
-    for (string s : wrd11Ltr) {
-        sequenceEnumToDo = rand() % SEQ_ENUM_VARIANTS;
-        if (DO_SEQ_ENUM == sequenceEnumToDo) {
-            SequenceEnum * temp = new SequenceEnum(s);
-            wordHolder11Ltr.push_back(temp); //Do sequence Enum
+        else if ("--perf" == option) {
+            options.benchPerf = true;
         }
-        else if (DO_SEQ_EXTRACT == sequenceEnumToDo) {
-            //Gotta figure out a substring from the word to have removed
-            string substr;
-            //Calculate substring start index
-            substrStartIndex = (rand()%(ELEVEN_LETTERS - SECND_LTR_OF_WRD_INDX))
-            + SECND_LTR_OF_WRD_INDX; //(rand() % (11 - 1)) + 1
-            //Calculate substring length based off of word length and start indx
-            if (substrStartIndex > SECND_LTR_OF_WRD_INDX) {
-                substrLength = (rand() % THREE_LETTERS) + SECND_LTR_OF_WRD_INDX;
-                //Need to make sure substrLength isn't too long
-                if ( (substrLength + substrStartIndex) > ELEVEN_LETTERS) {
-                    substrLength = ELEVEN_LETTERS - substrStartIndex;//11-start
-                }
-            }
-            else { //I am keeping the length low here so that the words are not
-                //   impossible to guess
-                substrLength = (rand() % FIVE_LETTERS) + SECND_LTR_OF_WRD_INDX;
-            }
-            substr = s.substr(substrStartIndex, substrLength); //Get substring
-            SeqExtract * temp = new SeqExtract(s, substr);
-            wordHolder11Ltr.push_back(temp);
+        else if ("--reps" == option && haveValue && atoi(argv[i + 1]) > 0) {
+            options.benchReps = atoi(argv[++i]);
         }
-        else { //if DO_SPAS_ENUM == sequenceEnumToDo
-            SpasEnum * temp = new SpasEnum(s);
-            wordHolder11Ltr.push_back(temp);
+        else if ("--seed" == option && haveValue) {
+            options.benchSeed = strtoull(argv[++i], nullptr, 10);
         }
-    }
-    std::vector<SequenceEnum *> wordHolder12Ltr;
-    for (string s : wrd12Ltr) {
-        sequenceEnumToDo = rand() % SEQ_ENUM_VARIANTS;
-        if (DO_SEQ_ENUM == sequenceEnumToDo) {
-            SequenceEnum * temp = new SequenceEnum(s);
-            wordHolder12Ltr.push_back(temp); //Do sequence Enum
+        else if ("--bench-json" == option && haveValue) {
+            options.benchJsonPath = argv[++i];
         }
-        else if (DO_SEQ_EXTRACT == sequenceEnumToDo) {
-            //Gotta figure out a substring from the word to have removed
-            string substr;
-            //Calculate substring start index
-            substrStartIndex = (rand() %(TWELVE_LETTERS -SECND_LTR_OF_WRD_INDX))
-            + SECND_LTR_OF_WRD_INDX; //(rand() % (12 - 1)) + 1
-            //Calculate substring length based off of word length and start indx
-            if (substrStartIndex > SECND_LTR_OF_WRD_INDX) {
-                substrLength = (rand() % THREE_LETTERS) + SECND_LTR_OF_WRD_INDX;
-                //Need to make sure substrLength isn't too long
-                if ( (substrLength + substrStartIndex) > TWELVE_LETTERS) {
-                    substrLength = TWELVE_LETTERS - substrStartIndex;//12-start
-                }
-            }
-            else { //I am keeping the length low here so that the words are not
-                //   impossible to guess
-                substrLength = (rand() % FIVE_LETTERS) + SECND_LTR_OF_WRD_INDX;
-            }
-            substr = s.substr(substrStartIndex, substrLength); //Get substring
-            SeqExtract * temp = new SeqExtract(s, substr);
-            wordHolder12Ltr.push_back(temp);
+        else if ("--compare" == option && i + 2 < argc) {
+            options.compareBaseline = argv[++i];
+            options.compareCandidate = argv[++i];
         }
-        else { //if DO_SPAS_ENUM == sequenceEnumToDo
-            SpasEnum * temp = new SpasEnum(s);
-            wordHolder12Ltr.push_back(temp);
+        else if ("--threshold" == option && haveValue &&
+                 atof(argv[i + 1]) >= 0.0) {
+            options.regressionThreshold = atof(argv[++i]);
         }
-    }
-    
-    //-------------------------------------------------------------------
-    //Start
-    //-------------------------------------------------------------------
-    printWelcome();
-    //Game loop
-    while (keepPlaying) {
-        userInputInt = getUserInputInt(userPromptForWordLength);
-        if (0 == userInputInt) {
-            break;
+        else if ("--footprint" == option) {
+            options.footprint = true;
         }
-        else if (THREE_LETTERS == userInputInt) {
-            randomWordInVector = rand() % numWordsOfEachLength[THREE_LETTERS];
-           
-                doUserGuess(wordHolder3Ltr.at(randomWordInVector),
-                            correctGuesses, incorrectGuesses);
+        else if ("--fast-start" == option) {
+            options.fastStart = true;
         }
-        else if (FOUR_LETTERS == userInputInt) {
-            randomWordInVector = rand() % numWordsOfEachLength[FOUR_LETTERS];
-            doUserGuess(wordHolder4Ltr.at(randomWordInVector), correctGuesses,
-                        incorrectGuesses);
+        else if ("--startup-bench" == option) {
+            options.startupBench = true;
         }
-        else if (FIVE_LETTERS == userInputInt) {
-            randomWordInVector = rand() % numWordsOfEachLength[FIVE_LETTERS];
-            doUserGuess(wordHolder5Ltr.at(randomWordInVector), correctGuesses,
-                        incorrectGuesses);
+        else if ("--record" == option && haveValue) {
+            options.recordPath = argv[++i];
         }
-        else if (SIX_LETTERS == userInputInt) {
-            randomWordInVector = rand() % numWordsOfEachLength[SIX_LETTERS];
-            doUserGuess(wordHolder6Ltr.at(randomWordInVector), correctGuesses,
-                        incorrectGuesses);
+        else if ("--replay" == option && haveValue) {
+            options.replayPath = argv[++i];
         }
-        else if (SEVEN_LETTERS == userInputInt) {
-            randomWordInVector = rand() % numWordsOfEachLength[SEVEN_LETTERS];
-            doUserGuess(wordHolder7Ltr.at(randomWordInVector), correctGuesses,
-                        incorrectGuesses);
+        else if ("--profile" == option && haveValue) {
+            options.profilePath = argv[++i];
         }
-        else if (EIGHT_LETTERS == userInputInt) {
-            randomWordInVector = rand() % numWordsOfEachLength[EIGHT_LETTERS];
-            doUserGuess(wordHolder8Ltr.at(randomWordInVector), correctGuesses,
-                        incorrectGuesses);
+        else if ("--profile-hz" == option && haveValue) {
+            options.profileHz = atoi(argv[++i]);
         }
-        else if (NINE_LETTERS == userInputInt) {
-            randomWordInVector = rand() % numWordsOfEachLength[NINE_LETTERS];
-            doUserGuess(wordHolder9Ltr.at(randomWordInVector), correctGuesses,
-                        incorrectGuesses);
+        else if ("--distribution" == option) {
+            options.distribution = true;
         }
-        else if (TEN_LETTERS == userInputInt) {
-            randomWordInVector = rand() % numWordsOfEachLength[TEN_LETTERS];
-            doUserGuess(wordHolder10Ltr.at(randomWordInVector), correctGuesses,
-                        incorrectGuesses);
+        else if ("--samples" == option && haveValue &&
+                 strtoull(argv[i + 1], nullptr, 10) > 0u) {
+            options.distributionSamples = strtoull(argv[++i], nullptr, 10);
         }
-        else if (ELEVEN_LETTERS == userInputInt) {
-            randomWordInVector = rand() % numWordsOfEachLength[ELEVEN_LETTERS];
-            doUserGuess(wordHolder11Ltr.at(randomWordInVector), correctGuesses,
-                        incorrectGuesses);
+        else if ("--trace" == option && haveValue) {
+            options.tracePath = argv[++i];
         }
-        else { //if (TWELVE_LETTERS == userInputInt)
-            randomWordInVector = rand() % numWordsOfEachLength[TWELVE_LETTERS];
-            doUserGuess(wordHolder12Ltr.at(randomWordInVector), correctGuesses,
-                        incorrectGuesses);
+        else if ("--trace-sample" == option && haveValue &&
+                 atof(argv[i + 1]) >= 0.0 && atof(argv[i + 1]) <= 1.0) {
+            options.traceSampleRate = atof(argv[++i]);
+        }
+        else {
+            std::cerr << "Usage: " << argv[0] << " [--serve-tcp PORT | "
+            "--serve-unix PATH] [--threads N] [--script FILE]\n"
+            "       [--load-test BOTS [--rounds N] "
+            "[--strategy oracle|random|solver|mixed]]\n"
+            "       [--encrypt FILE|- [--binary] "
+            "[--transform enum|extract|spas|random]]\n"
+            "       [--grade FILE|-] [--event-log DIR] [--aggregate DIR]\n"
+            "       [--latency-json FILE] [--trace FILE "
+            "[--trace-sample 0..1]]\n"
+            "       [--bench [--perf] [--reps N] [--seed N] "
+            "[--bench-json FILE]]\n"
+            "       [--compare BASELINE CANDIDATE [--threshold PERCENT]]\n"
+            "       [--footprint] [--fast-start] [--startup-bench]\n"
+            "       [--record FILE | --replay FILE [--reps N]]\n"
+            "       [--profile FILE [--profile-hz N]]\n"
+            "       [--distribution [--samples N]]"
+            << std::endl;
+            return false;
         }
-        percentCorrect = ((float) correctGuesses /
-                          (float) (incorrectGuesses + correctGuesses)) *
-        ONE_HUNDRED_PERCENT;
-        
-        cout << "\nScore so far:\nCorrect: " << correctGuesses;
-        cout << "\nIncorrect: " << incorrectGuesses;
-        cout << "\nTotal Guesses: " << incorrectGuesses + correctGuesses;
-        cout << "\nGuess Percentage: " << percentCorrect << "%" << std::endl;
-    }
-    printFarewell(correctGuesses, incorrectGuesses);
-    
-    //-------------------------------------------------------------------
-    // Clean-Up (DELETE ALL HEAP MEMORY ALLOCATED WITH 'NEW')
-    //-------------------------------------------------------------------
-    for (std::vector<SequenceEnum *>::iterator it = wordHolder3Ltr.begin();
-         it != wordHolder3Ltr.end(); ++it) {
-        delete *it;
-    }
-    for (std::vector<SequenceEnum *>::iterator it = wordHolder4Ltr.begin();
-         it != wordHolder4Ltr.end(); ++it) {
-        delete *it;
     }
-    for (std::vector<SequenceEnum *>::iterator it = wordHolder5Ltr.begin();
-         it != wordHolder5Ltr.end(); ++it) {
-        delete *it;
+    return true;
+}
+
+//Serves the game to every player who connects until SIGINT or SIGTERM
+int runServer(EpochCorpus& corpusEpochs, uint64_t seed,
+              const ProgramOptions& options, const sigset_t& stopSignals) {
+    int port = options.servePort;
+    const string& path = options.servePath;
+    GameServer server(corpusEpochs, seed);
+    server.setEventLogDirectory(options.eventLogPath);
+    bool listening = path.empty() ? server.listenTcp(port) :
+    server.listenUnix(path);
+    if (!listening) {
+        return EXIT_FAILURE;
     }
-    for (std::vector<SequenceEnum *>::iterator it = wordHolder6Ltr.begin();
-         it != wordHolder6Ltr.end(); ++it) {
-        delete *it;
+    server.start(options.serveThreads);
+    cout << "Serving the Sequence Enumeration Guessing Game on ";
+    if (path.empty()) {
+        cout << "port " << port;
     }
-    for (std::vector<SequenceEnum *>::iterator it = wordHolder7Ltr.begin();
-         it != wordHolder7Ltr.end(); ++it) {
-        delete *it;
+    else {
+        cout << path;
     }
-    for (std::vector<SequenceEnum *>::iterator it = wordHolder8Ltr.begin();
-         it != wordHolder8Ltr.end(); ++it) {
-        delete *it;
+    cout << ". Press Ctrl-C to stop." << std::endl;
+    int caught;
+    sigwait(&stopSignals, &caught);
+    server.stop();
+    cout << "Server stopped. Guesses by every player:" << std::endl;
+    server.getStats().report(cout);
+    return EXIT_SUCCESS;
+}
+
+//Plays one game with every line of the file as the player's input, and
+//prints the whole transcript once the game is over
+int runScript(EpochCorpus& corpusEpochs, FastRandom& rng,
+              const ProgramOptions& options) {
+    std::ifstream scriptFile(options.scriptPath);
+    if (!scriptFile) {
+        std::cerr << "Could not open script " << options.scriptPath
+        << std::endl;
+        return EXIT_FAILURE;
     }
-    for (std::vector<SequenceEnum *>::iterator it = wordHolder9Ltr.begin();
-         it != wordHolder9Ltr.end(); ++it) {
-        delete *it;
+    EventLog events(options.eventLogPath, 0);
+    if (!options.eventLogPath.empty()) {
+        events.open();
     }
-    for (std::vector<SequenceEnum *>::iterator it = wordHolder10Ltr.begin();
-         it != wordHolder10Ltr.end(); ++it) {
-        delete *it;
+    int readerSlot = corpusEpochs.registerReader();
+    ScriptedChannel script(scriptFile);
+    GameSession session(corpusEpochs, readerSlot, rng, nullptr, &events);
+    GameTask game = session.play(script); //Finishes before returning
+    cout << script.getOutput().toString();
+    corpusEpochs.unregisterReader(readerSlot);
+    return EXIT_SUCCESS;
+}
+
+//Plays the game on the terminal while recording the seeds and every line
+//typed, and saves the recording once the game is over. The game doesn't use
+//the puzzle pool, whose puzzles depend on when its producer got to run.
+int runRecord(EpochCorpus& corpusEpochs, uint64_t corpusSeed,
+              uint64_t sessionSeed, const ProgramOptions& options) {
+    SessionRecording recording(corpusSeed, sessionSeed);
+    int readerSlot = corpusEpochs.registerReader();
+    FastRandom rng(sessionSeed);
+    RecordingChannel terminal(recording);
+    GameSession session(corpusEpochs, readerSlot, rng);
+    GameTask game = session.play(terminal); //Finishes before returning
+    corpusEpochs.unregisterReader(readerSlot);
+    return recording.save(options.recordPath) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+//Replays a recorded game --reps times, checks that it went the same way every
+//time, and prints how long each round took
+int runReplay(EpochCorpus& corpusEpochs, const SessionRecording& recording,
+              const ProgramOptions& options) {
+    SessionReplayer replayer(corpusEpochs, recording);
+    if (!replayer.run(options.benchReps)) {
+        return EXIT_FAILURE;
     }
-    for (std::vector<SequenceEnum *>::iterator it = wordHolder11Ltr.begin();
-         it != wordHolder11Ltr.end(); ++it) {
-        delete *it;
+    replayer.report(cout);
+    return EXIT_SUCCESS;
+}
+
+//Plays complete games with simulated players and reports throughput,
+//grading latency and memory per session
+int runLoadTest(EpochCorpus& corpusEpochs, const Dictionary& dictionary,
+                uint64_t seed, const ProgramOptions& options) {
+    BotStrategy strategy;
+    if (!BotPlayer::parseStrategy(options.loadStrategy, strategy) ||
+        options.loadRounds <= 0) {
+        std::cerr << "Bad --strategy or --rounds for the load test"
+        << std::endl;
+        return EXIT_FAILURE;
     }
-    for (std::vector<SequenceEnum *>::iterator it = wordHolder12Ltr.begin();
-          it != wordHolder12Ltr.end(); ++it) {
-        delete *it;
+    LoadGenerator generator(corpusEpochs, dictionary, seed);
+    generator.setEventLogDirectory(options.eventLogPath);
+    if (!generator.run(options.loadBots, options.loadRounds, strategy,
+                       options.serveThreads, cout)) {
+        return EXIT_FAILURE;
     }
     return EXIT_SUCCESS;
 }
 
-int getUserInputInt(string& prompt) {
-    bool invalidInput;
-    int inputInt = 0;
-    do { //Keep asking for input until valid input is given
-        cout << prompt << std::endl;
-        std::cin >> std::ws;  // eat up any leading white spaces
-        int usrInput = std::cin.peek();  // peek character
-        if ( std::isdigit(usrInput) ) {
-            std::cin >> inputInt;
-            //Now check to see if inputInt is in the correct range
-            if( (inputInt < MAX_PREDEFINED_WORD_LENGTH &&
-                 inputInt >= THREE_LETTERS) || 0 == inputInt) {
-                invalidInput = false;
-            }
-            else {
-                cout << "\nError, the number you entered is " << inputInt;
-                cout << " which is outside the range ";
-                cout << THREE_LETTERS << " to " << TWELVE_LETTERS;
-                cout << std::endl << "Please try again\n";
-                invalidInput = true;
-            }
-        }
-        else { //If user did not enter an integer
-            string badInput;
-            std::cin >> badInput;
-            cout << "\nError, Invalid Input. You entered: " << badInput << '\n';
-            cout << std::endl << "Please try again\n";
-            invalidInput = true;
-        }
-    } while (invalidInput);
-    return inputInt;
+//Encrypts every word of a list and writes "original<TAB>encrypted<TAB>
+//transform" records to stdout
+int runBatchEncrypt(const ProgramOptions& options) {
+    int variant;
+    if (!PuzzleFactory::parseVariant(options.encryptTransform, variant)) {
+        std::cerr << "Bad --transform " << options.encryptTransform
+        << std::endl;
+        return EXIT_FAILURE;
+    }
+    WordReader words(options.encryptBinary ? WORD_LENGTH_PREFIXED : WORD_LINES);
+    if (!words.open(options.encryptPath)) {
+        return EXIT_FAILURE;
+    }
+    BatchEncryptor encryptor(variant);
+    return runRecordJob(encryptor, words, options.serveThreads,
+                        (uint64_t) time(NULL));
 }
 
-void printFarewell(int correct, int incorrect) {
-    int totalGuesses = correct + incorrect;
-    float percentCorrect;
-    if (totalGuesses > 0)
-        percentCorrect = ((float) correct / (float) totalGuesses) *
-        ONE_HUNDRED_PERCENT;
-    else
-        percentCorrect = 0.0;
-    
-    cout << "Thanks for playing. Your final score was: \n";
-    cout << "Correct Guesses: " << correct << std::endl;
-    cout << "Incorrect Guesses: " << incorrect << std::endl;
-    cout << "Total Guesses: " << totalGuesses << std::endl;
-    cout << "Guess Percentage: " << percentCorrect << "%\n";
-    if (percentCorrect > FIFTY_PERCENT)
-        cout << "Nice Work!";
-    else
-        cout << "Better luck next time!";
-    cout << std::endl << "Goodbye!" << std::endl;
+//Grades every "LENGTH:INDEX<TAB>guess" record of a log against the corpus
+//and writes each record with its grade to stdout
+int runGrader(EpochCorpus& corpusEpochs, const Dictionary& dictionary,
+              const ProgramOptions& options) {
+    WordReader guesses(WORD_LINES);
+    if (!guesses.open(options.gradePath)) {
+        return EXIT_FAILURE;
+    }
+    int readerSlot = corpusEpochs.registerReader();
+    int status;
+    { //Keeps the corpus pinned while the workers read it
+        EpochCorpus::ReadGuard corpus(corpusEpochs, readerSlot);
+        GuessGrader grader(*corpus, dictionary);
+        status = runRecordJob(grader, guesses, options.serveThreads,
+                              (uint64_t) time(NULL));
+    }
+    corpusEpochs.unregisterReader(readerSlot);
+    return status;
 }
 
-void printWelcome(void) {
-    cout << "Welcome to the Sequence Enumeration Guessing Game!\n";
-    cout << "Would you like to review the rules before the game starts? [y/n] ";
-    char userInput = std::cin.get();
-    if (userInput == 'y' || userInput == 'Y') {
-        cout << std::endl << std::endl;
-        cout << "Rules: The game begins by the player selecting the length of\n"
-        "a word. A word of that length is then used to generate\na SequenceEnum"
-        " variation of itself, which is then displayed\nto the player. The "
-        "player has 3 guesses to guess what the original\nword was before"
-        " it was modified by the SequenceEnum. After 3 incorrect\nguesses, "
-        "the game will let the player know what the word they have been\ntrying"
-        " to guess actually is." << std::endl;
+//Sums up every round in the event log directory and prints the success
+//rates by word length and by transform
+int runAggregate(const string& directory) {
+    EventAggregator aggregator;
+    if (!aggregator.scanDirectory(directory)) {
+        return EXIT_FAILURE;
     }
-    clearInputStream();
-    cout << std::endl;
+    aggregator.report(cout);
+    return EXIT_SUCCESS;
 }
 
-//I need to clear the input stream frequently enough to justify doing it as its
-//own function
-void clearInputStream(void) {
-    std::cin.clear();
-    std::fflush(stdin);
+//Prints the latency probes to stderr (if they were compiled in) and writes
+//them to the --latency-json file (if one was given)
+void dumpLatencies(const ProgramOptions& options) {
+    if (Instrumentation::isEnabled()) {
+        Instrumentation::dumpText(std::cerr);
+    }
+    if (!options.latencyJsonPath.empty()) {
+        std::ofstream json(options.latencyJsonPath);
+        if (!json) {
+            std::cerr << "Could not write " << options.latencyJsonPath
+            << std::endl;
+            return;
+        }
+        Instrumentation::dumpJson(json);
+    }
 }
 
-void doUserGuess(SequenceEnum* word, int& correct, int& incorrect) {
-    int userGuessCounter = 0;
-    bool userWordGuessCorrect = false;
-    do {
-        clearInputStream(); //clear any leftover input in input stream
-        
-        cout << "Can you guess what this word was before it was\nmodified by "
-        "the SequenceEnum?\n";
-        cout << "Modified word to guess: " << word->emitWord() << std::endl;
-        cout << "Enter your guess: ";
-        //std::cin >> std::ws;  // eat up any leading white spaces
-        string userWordGuess;
-        std::cin >> userWordGuess;
-        if (word->guessWord(userWordGuess)) {
-            correct++;
-            cout << "\nCORRECT! Way to go!\n";
-            userWordGuessCorrect = true;
+//Times the operations of each puzzle class over every word in the game
+int runBench(const string * const wordArrays[], const int * numWords,
+             const ProgramOptions& options) {
+    std::vector<string> words;
+    for (int len = 0; len < MAX_PREDEFINED_WORD_LENGTH; len++) {
+        for (int i = 0; i < numWords[len]; i++) {
+            words.push_back(wordArrays[len][i]);
         }
-        else {
-            incorrect++;
-            userGuessCounter++;
-            cout << "\nWrong! Try again. You entered: " << userWordGuess;
-            if (userGuessCounter >= MAX_GUESSES) {
-                cout << "\nUh-oh! You used up all your guesses...\n";
-                cout << "The word you were trying to guess was: ";
-                if (word->getSeqEnumIsActive()) {
-                    word->toggleSeqEnumActivation();
-                }
-                else { //Turn off other seqEnum type, then turn off this one so
-                    //everything is off
-                    word->toggleSeqEnumActivation();
-                    word->toggleSeqEnumActivation();
-                }
-                cout << word->emitWord();
-                word->toggleSeqEnumActivation(); //Turn back on seqEnum
-                cout << std::endl;
-                return;
-            }
-            else {
-                cout << std::endl << "Please try again. Guesses remaining: ";
-                cout << MAX_GUESSES - userGuessCounter;
-                cout << std::endl;
-            }
+    }
+    BenchRunner runner(words, options.benchReps, options.benchPerf,
+                       options.benchSeed);
+    runner.run();
+    runner.report(cout);
+    if (!options.benchJsonPath.empty()) {
+        std::ofstream json(options.benchJsonPath);
+        if (!json) {
+            std::cerr << "Could not write " << options.benchJsonPath
+            << std::endl;
+            return EXIT_FAILURE;
         }
-    } while (!userWordGuessCorrect);
+        runner.writeJson(json);
+    }
+    if (options.distribution) { //--bench --distribution runs both
+        return runDistribution(wordArrays, numWords, options);
+    }
+    return EXIT_SUCCESS;
 }
 
+//Measures the transforms' random choices by building the given number of
+//puzzles per word length, on --threads threads
+int runDistribution(const string * const wordArrays[], const int * numWords,
+                    const ProgramOptions& options) {
+    DistributionProfiler profiler(wordArrays, numWords,
+                                  MAX_PREDEFINED_WORD_LENGTH,
+                                  (uint64_t) time(NULL));
+    profiler.run(options.distributionSamples, options.serveThreads);
+    profiler.report(cout);
+    return EXIT_SUCCESS;
+}
 
-//This function loops through each array of words of a certain length, counts
-//the number of words in each array, and then puts those counts in a seperate
-//array to keep track of their lengths
-void countWordsOfEachLength(int * lengthsArray) {
-    int counter = 0;
-    lengthsArray[ZERO_LETTERS] = 0; //There are no 0 letter words
-    lengthsArray[ONE_LETTER] = 0; //There are no 1 letter words
-    lengthsArray[TWO_LETTERS] = 0; //There are no 2 letter words
-    //Count number of 3 letter words
-    for (string s : wrd3Ltr)  //Range-based for loops rule!
-        counter++;
-    
-    lengthsArray[THREE_LETTERS] = counter;
-    counter = 0; //reset counter
-    //count the number of 4 letter words
-    for (string s : wrd4Ltr)  //Range-based for loops rule!
-        counter++;
+//Compares two --bench-json runs. Fails if either can't be read or is cut
+//short, if any benchmark regressed by more than the threshold, or if the
+//candidate is missing any of the baseline's benchmarks.
+int runCompare(const ProgramOptions& options) {
+    BenchComparator comparator(options.regressionThreshold);
+    if (!comparator.load(options.compareBaseline, options.compareCandidate)) {
+        return EXIT_FAILURE;
+    }
+    comparator.compare();
+    comparator.report(cout);
+    return (comparator.anyRegressed() || comparator.anyMissing()) ?
+    EXIT_FAILURE : EXIT_SUCCESS;
+}
 
-    lengthsArray[FOUR_LETTERS] = counter;
-    counter = 0; //reset counter
-    //Count number of 5 letter words
-    for (string s : wrd5Ltr)  //Range-based for loops rule!
-        counter++;
-    lengthsArray[FIVE_LETTERS] = counter;
-    counter = 0; //reset counter
-    //count the number of 6 letter words
-    for (string s : wrd6Ltr)  //Range-based for loops rule!
-        counter++;
-    lengthsArray[SIX_LETTERS] = counter;
-    counter = 0; //reset counter
-    //Count number of 7 letter words
-    for (string s : wrd7Ltr)
-        counter++;
-    lengthsArray[SEVEN_LETTERS] = counter;
-    counter = 0; //reset counter
-    //count the number of 8 letter words
-    for (string s : wrd8Ltr)
-        counter++;
-    lengthsArray[EIGHT_LETTERS] = counter;
-    counter = 0; //reset counter
-    //Count number of 9 letter words
-    for (string s : wrd9Ltr)
-        counter++;
-    lengthsArray[NINE_LETTERS] = counter;
-    counter = 0; //reset counter
-    //count the number of 10 letter words
-    for (string s : wrd10Ltr)
-        counter++;
-    lengthsArray[TEN_LETTERS] = counter;
-    counter = 0; //reset counter
-    //Count number of 11 letter words
-    for (string s : wrd11Ltr)
-        counter++;
-    lengthsArray[ELEVEN_LETTERS] = counter;
-    counter = 0; //reset counter
-    //count the number of 12 letter words
-    for (string s : wrd12Ltr)
-        counter++;
-    lengthsArray[TWELVE_LETTERS] = counter;
+//Prints what the word arrays, the dictionary and the corpus take in memory.
+//The corpus's transform objects are thrown away once it is built, so they
+//are rebuilt here one at a time (with each puzzle's own transform) to see
+//what holding them would take.
+int runFootprint(const string * const wordArrays[], const int * numWords,
+                 const Dictionary& dictionary, EpochCorpus& corpusEpochs) {
+    int readerSlot = corpusEpochs.registerReader();
+    EpochCorpus::ReadGuard guard(corpusEpochs, readerSlot);
+    const Corpus& corpus = *guard;
+    MemoryFootprint footprint;
+    footprint.addWordArrays(wordArrays, numWords, MAX_PREDEFINED_WORD_LENGTH);
+    footprint.addDictionary(dictionary);
+    footprint.addCorpus(corpus);
+    for (int len = 0; len < MAX_PREDEFINED_WORD_LENGTH; len++) {
+        for (int i = 0; i < corpus.getNumPuzzles(len); i++) {
+            int transform = corpus.getPuzzle(len, i).getTransform();
+            std::unique_ptr<SequenceEnum> object(
+                PuzzleFactory::makeVariant(corpus.getWord(len, i), transform));
+            footprint.addTransformObject(*object, transform);
+        }
+    }
+    footprint.report(cout);
+    return EXIT_SUCCESS;
+}
+
+//Runs a batch job on --threads workers (one per hardware thread by default)
+//and prints its summary to stderr, so it stays out of the output
+int runRecordJob(const RecordProcessor& processor, WordReader& input,
+                 unsigned int threads, uint64_t seed) {
+    if (0u == threads) {
+        threads = std::thread::hardware_concurrency();
+    }
+    BatchTally tally;
+    bool finished;
+    auto start = std::chrono::steady_clock::now();
+    if (threads <= 1u) { //Nothing to overlap with on one core
+        finished = processor.run(input, STDOUT_FILENO, tally, seed);
+    }
+    else { //Overlap reading, processing and writing
+        RecordPipeline pipeline(processor, threads, seed);
+        finished = pipeline.run(input, STDOUT_FILENO, tally);
+    }
+    std::chrono::duration<double> elapsed =
+    std::chrono::steady_clock::now() - start;
+    processor.report(tally, elapsed.count(), std::cerr);
+    return finished ? EXIT_SUCCESS : EXIT_FAILURE;
 }